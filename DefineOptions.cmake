@@ -1,4 +1,6 @@
 option(CGREEN_WITH_STATIC_LIBRARY "Build with a static library" OFF)
 option(CGREEN_WITH_UNIT_TESTS "Build unit tests" ON)
+option(CGREEN_WITH_ALLOCATION_COUNTING "Build the cgreen_allocations library, which counts the allocations of tests that link it" ON)
+option(CGREEN_WITH_BENCHMARK_BASELINE_TESTS "Fail the unit tests if mocks are slower than their saved baseline" OFF)
 option(CGREEN_INTERNAL_WITH_GCOV "Build with test coverage instrumentation" OFF)
 mark_as_advanced(CGREEN_INTERNAL_WITH_GCOV)
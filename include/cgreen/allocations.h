@@ -0,0 +1,45 @@
+#ifndef ALLOCATIONS_HEADER
+#define ALLOCATIONS_HEADER
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+namespace cgreen {
+    extern "C" {
+#endif
+
+/* How many times, or how many bytes, malloc(), calloc(), realloc() and
+   the other allocation functions allocated while evaluating the
+   expression, e.g.
+
+       assert_that(allocations_during(parse(document)), is_equal_to(0));
+
+   Where allocations can't be counted both are always 0, which
+   allocations_can_be_counted() tells. */
+#define allocations_during(expression) \
+    (start_counting_allocations_during(), (void)(expression), \
+     allocations_counted_during("allocations_during(" #expression ")"))
+#define bytes_allocated_during(expression) \
+    (start_counting_allocations_during(), (void)(expression), \
+     bytes_allocated_counted_during("bytes_allocated_during(" #expression ")"))
+
+/* Fail the test if anything allocated in it after this, or in its
+   teardown, is not freed when it is finished. Set the environment
+   variable CGREEN_NO_NET_ALLOCATIONS to expect it of every test, from
+   before its setup. */
+void expect_no_net_allocations(void);
+
+bool allocations_can_be_counted(void);
+
+void start_counting_allocations_during(void);
+intptr_t allocations_counted_during(const char *expression);
+intptr_t bytes_allocated_counted_during(const char *expression);
+const char *expression_of_counted_allocations(const char *actual_string);
+
+#ifdef __cplusplus
+    }
+}
+#endif
+
+#endif
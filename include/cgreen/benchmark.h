@@ -0,0 +1,52 @@
+#ifndef BENCHMARK_HEADER
+#define BENCHMARK_HEADER
+
+#include <cgreen/unit.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+namespace cgreen {
+    extern "C" {
+#endif
+
+typedef struct CgreenBenchmark_ CgreenBenchmark;
+
+/* TDD Style: Benchmark(name) {implementation} */
+/* BDD Style: Benchmark(subject, name) {implementation} */
+/* The implementation gets a 'benchmark' and should do what is measured
+   benchmark_iterations(benchmark) times. It is run repeatedly until the
+   statistics are good enough to be reported, but the setup and
+   teardown are only run once, before and after all of the runs. */
+#define Benchmark(...) Benchmark_NARG(0, __VA_ARGS__)(0, __VA_ARGS__)
+
+/* Temporarily ignore this benchmark */
+#define xBenchmark(...) Benchmark_NARG(1, __VA_ARGS__)(1, __VA_ARGS__)
+
+uint64_t benchmark_iterations(CgreenBenchmark *benchmark);
+
+/* Exclude what is done in between, like preparations for the next
+   iteration, from the measured time */
+void pause_benchmark_timing(CgreenBenchmark *benchmark);
+void resume_benchmark_timing(CgreenBenchmark *benchmark);
+
+/* Pretend to use the value, so that computing it can't be optimised away */
+void benchmark_use(const void *value);
+
+/* Fail benchmarks that are significantly, and more than threshold
+   percent, slower than the same benchmarks in the baseline file. Can
+   also be set by the CGREEN_BENCHMARK_BASELINE and
+   CGREEN_BENCHMARK_THRESHOLD environment variables */
+void compare_benchmarks_with_baseline(const char *filename, double threshold);
+
+/* Write the results of the benchmarks that are run to a new baseline file */
+void save_benchmarks_as_baseline(const char *filename);
+
+void run_benchmark(void (*body)(CgreenBenchmark *benchmark), const char *name,
+                   const char *filename, int line);
+
+#ifdef __cplusplus
+    }
+}
+#endif
+
+#endif
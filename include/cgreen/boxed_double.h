@@ -8,6 +8,9 @@ namespace cgreen {
     extern "C" {
 #endif
 
+/* Doubles are passed to and returned from mocks in an intptr_t. Where
+   that is as large as a double the box is the double itself, otherwise
+   it is allocated, and freed by unbox_double() */
 intptr_t box_double(double d);
 double as_double(intptr_t boxed_double);
 double unbox_double(intptr_t boxed_double);
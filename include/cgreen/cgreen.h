@@ -1,10 +1,13 @@
 #include <stdlib.h>
 #include <cgreen/unit.h>
+#include <cgreen/benchmark.h>
+#include <cgreen/journal.h>
 #include <cgreen/suite.h>
 #include <cgreen/text_reporter.h>
 #include <cgreen/cdash_reporter.h>
 #include <cgreen/cute_reporter.h>
 #include <cgreen/assertions.h>
+#include <cgreen/allocations.h>
 #include <cgreen/constraint_syntax_helpers.h>
 #include <cgreen/runner.h>
 #include <cgreen/boxed_double.h>
@@ -44,10 +44,33 @@ struct Constraint_ {
 
 #ifdef __cplusplus
 namespace cgreen {
+    /* A temporary lasts until the end of the assertion it is made in */
+    inline Constraint *assertion_storage(const Constraint &storage) {
+        return const_cast<Constraint *>(&storage);
+    }
+#define constraint_in_assertion_storage(constraint) \
+    (make_next_constraint_in(cgreen::assertion_storage(Constraint())), (constraint))
+
     extern "C" {
+#else
+#define constraint_in_assertion_storage(constraint) \
+    (make_next_constraint_in(&(Constraint){0}), (constraint))
 #endif
 
+/* The next of the built-in constraints made in this thread is made in
+   the storage instead of being allocated, and only that one. Given by
+   assertions just before their constraint is made, the storage lasts
+   until the assertion returns, and the assertion forgets it in case no
+   built-in constraint took it. A constraint made outside an assertion
+   is allocated. */
+void make_next_constraint_in(Constraint *storage);
+
 Constraint *create_constraint(void);
+
+/* A constraint made in the storage of an assertion is copied if it is
+   to be kept after it, otherwise the constraint itself is returned */
+Constraint *keep_constraint(Constraint *constraint);
+
 Constraint *create_parameter_constraint_for(const char *parameter_name);
 
 bool compare_want_value(Constraint *constraint, CgreenValue actual);
@@ -57,25 +80,44 @@ void test_want(Constraint *constraint, const char *function, CgreenValue actual,
 void test_constraint(Constraint *constraint, const char *function, intptr_t actual, const char *test_file, int test_line, TestReporter *reporter);
 
 Constraint *create_equal_to_value_constraint(intptr_t expected_value, const char *expected_value_name);
+Constraint *create_equal_to_value_constraint_in(Constraint *storage, intptr_t expected_value, const char *expected_value_name);
 Constraint *create_equal_to_hexvalue_constraint(intptr_t expected_value, const char *expected_value_name);
+Constraint *create_equal_to_hexvalue_constraint_in(Constraint *storage, intptr_t expected_value, const char *expected_value_name);
 Constraint *create_not_equal_to_value_constraint(intptr_t expected_value, const char *expected_value_name);
+Constraint *create_not_equal_to_value_constraint_in(Constraint *storage, intptr_t expected_value, const char *expected_value_name);
 Constraint *create_greater_than_value_constraint(intptr_t expected_value, const char *expected_value_name);
+Constraint *create_greater_than_value_constraint_in(Constraint *storage, intptr_t expected_value, const char *expected_value_name);
 Constraint *create_less_than_value_constraint(intptr_t expected_value, const char *expected_value_name);
+Constraint *create_less_than_value_constraint_in(Constraint *storage, intptr_t expected_value, const char *expected_value_name);
 Constraint *create_equal_to_contents_constraint(void *pointer_to_compare, size_t size_to_compare, const char *compared_pointer_name);
+Constraint *create_equal_to_contents_constraint_in(Constraint *storage, void *pointer_to_compare, size_t size_to_compare, const char *compared_pointer_name);
 Constraint *create_not_equal_to_contents_constraint(void *pointer_to_compare, size_t size_to_compare, const char *compared_pointer_name);
+Constraint *create_not_equal_to_contents_constraint_in(Constraint *storage, void *pointer_to_compare, size_t size_to_compare, const char *compared_pointer_name);
 Constraint *create_equal_to_string_constraint(const char* expected_value, const char *expected_value_name);
+Constraint *create_equal_to_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name);
 Constraint *create_not_equal_to_string_constraint(const char* expected_value, const char *expected_value_name);
+Constraint *create_not_equal_to_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name);
 Constraint *create_contains_string_constraint(const char* expected_value, const char *expected_value_name);
+Constraint *create_contains_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name);
 Constraint *create_does_not_contain_string_constraint(const char* expected_value, const char *expected_value_name);
+Constraint *create_does_not_contain_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name);
 Constraint *create_begins_with_string_constraint(const char* expected_value, const char *expected_value_name);
+Constraint *create_begins_with_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name);
 Constraint *create_does_not_begin_with_string_constraint(const char* expected_value, const char *expected_value_name);
+Constraint *create_does_not_begin_with_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name);
 Constraint *create_ends_with_string_constraint(const char* expected_value, const char *expected_value_name);
+Constraint *create_ends_with_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name);
 Constraint *create_does_not_end_with_string_constraint(const char* expected_value, const char *expected_value_name);
+Constraint *create_does_not_end_with_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name);
 
 Constraint *create_equal_to_double_constraint(double expected_value, const char *expected_value_name);
+Constraint *create_equal_to_double_constraint_in(Constraint *storage, double expected_value, const char *expected_value_name);
 Constraint *create_not_equal_to_double_constraint(double expected_value, const char *expected_value_name);
+Constraint *create_not_equal_to_double_constraint_in(Constraint *storage, double expected_value, const char *expected_value_name);
 Constraint *create_less_than_double_constraint(double expected_value, const char *expected_value_name);
+Constraint *create_less_than_double_constraint_in(Constraint *storage, double expected_value, const char *expected_value_name);
 Constraint *create_greater_than_double_constraint(double expected_value, const char *expected_value_name);
+Constraint *create_greater_than_double_constraint_in(Constraint *storage, double expected_value, const char *expected_value_name);
 Constraint *create_return_value_constraint(intptr_t value_to_return);
 Constraint *create_return_double_value_constraint(double value_to_return);
 Constraint *create_set_parameter_value_constraint(const char *parameter_name, intptr_t value_to_set, size_t size_to_set);
@@ -15,15 +15,25 @@ class CppConstraint : public Constraint {
 };
 
 Constraint *create_equal_to_string_constraint(const std::string& expected_value, const char *expected_value_name);
+Constraint *create_equal_to_string_constraint_in(Constraint *storage, const std::string& expected_value, const char *expected_value_name);
 Constraint *create_equal_to_string_constraint(const std::string* expected_value, const char *expected_value_name);
+Constraint *create_equal_to_string_constraint_in(Constraint *storage, const std::string* expected_value, const char *expected_value_name);
 Constraint *create_not_equal_to_string_constraint(const std::string& expected_value, const char *expected_value_name);
+Constraint *create_not_equal_to_string_constraint_in(Constraint *storage, const std::string& expected_value, const char *expected_value_name);
 Constraint *create_not_equal_to_string_constraint(const std::string* expected_value, const char *expected_value_name);
+Constraint *create_not_equal_to_string_constraint_in(Constraint *storage, const std::string* expected_value, const char *expected_value_name);
 Constraint *create_contains_string_constraint(const std::string& expected_value, const char *expected_value_name);
+Constraint *create_contains_string_constraint_in(Constraint *storage, const std::string& expected_value, const char *expected_value_name);
 Constraint *create_contains_string_constraint(const std::string* expected_value, const char *expected_value_name);
+Constraint *create_contains_string_constraint_in(Constraint *storage, const std::string* expected_value, const char *expected_value_name);
 Constraint *create_does_not_contain_string_constraint(const std::string& expected_value, const char *expected_value_name);
+Constraint *create_does_not_contain_string_constraint_in(Constraint *storage, const std::string& expected_value, const char *expected_value_name);
 Constraint *create_does_not_contain_string_constraint(const std::string* expected_value, const char *expected_value_name);
+Constraint *create_does_not_contain_string_constraint_in(Constraint *storage, const std::string* expected_value, const char *expected_value_name);
 Constraint *create_begins_with_string_constraint(const std::string& expected_value, const char *expected_value_name);
+Constraint *create_begins_with_string_constraint_in(Constraint *storage, const std::string& expected_value, const char *expected_value_name);
 Constraint *create_begins_with_string_constraint(const std::string* expected_value, const char *expected_value_name);
+Constraint *create_begins_with_string_constraint_in(Constraint *storage, const std::string* expected_value, const char *expected_value_name);
 
 
 template<typename T>
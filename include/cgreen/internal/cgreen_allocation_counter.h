@@ -0,0 +1,33 @@
+#ifndef CGREEN_ALLOCATION_COUNTER_HEADER
+#define CGREEN_ALLOCATION_COUNTER_HEADER
+
+#include <cgreen/reporter.h>
+#ifndef __cplusplus
+#include <stdbool.h>
+#endif
+
+#ifdef __cplusplus
+namespace cgreen {
+    extern "C" {
+#endif
+
+/* What counts the allocations, when the allocation functions are
+   replaced by ones that can. Only the cgreen_allocations library
+   replaces them, and registers its counter when it is loaded, so
+   nothing is replaced in programs that don't link it. Starting
+   forgets what was counted before. */
+typedef struct {
+    void (*start)(void);
+    void (*stop)(void);
+    bool (*is_counting)(void);
+    void (*read)(CgreenAllocationUsage *counted);
+} CgreenAllocationCounter;
+
+void count_allocations_with(const CgreenAllocationCounter *counter);
+
+#ifdef __cplusplus
+    }
+}
+#endif
+
+#endif
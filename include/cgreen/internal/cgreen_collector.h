@@ -0,0 +1,32 @@
+#ifndef CGREEN_COLLECTOR_HEADER
+#define CGREEN_COLLECTOR_HEADER
+
+#include <sys/types.h>
+
+#ifdef __cplusplus
+namespace cgreen {
+    extern "C" {
+#endif
+
+/* Watches any number of test processes at once, for them exiting or
+   for something to read from them, and tells which are ready by the
+   context they were watched with, without looking at the others. A
+   process is watched for exiting with a pidfd where there are such,
+   and otherwise by its end of an exit pipe closing. The collector
+   takes over the exit pipe, and closes it when the process is
+   forgotten. */
+typedef struct CgreenCollector_ CgreenCollector;
+
+CgreenCollector *cgreen_collector_open(void);
+void cgreen_collector_close(CgreenCollector *collector);
+void cgreen_collector_watch_exit(CgreenCollector *collector, pid_t pid, int exit_pipe, void *context);
+void cgreen_collector_watch_channel(CgreenCollector *collector, int channel, void *context);
+void cgreen_collector_forget(CgreenCollector *collector, void *context);
+int cgreen_collector_wait(CgreenCollector *collector, int timeout, void **ready, int size);
+
+#ifdef __cplusplus
+    }
+}
+#endif
+
+#endif
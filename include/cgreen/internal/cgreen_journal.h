@@ -0,0 +1,34 @@
+#ifndef CGREEN_JOURNAL_HEADER
+#define CGREEN_JOURNAL_HEADER
+
+#include <cgreen/journal.h>
+#include <cgreen/reporter.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+namespace cgreen {
+    extern "C" {
+#endif
+
+/* The journal file is mapped into memory that is shared with the test
+   processes forked after it is created, and records are reserved and
+   published atomically since they write to it at the same time */
+CgreenJournalHeader *cgreen_journal_map(const char *filename, size_t size);
+CgreenJournalRecord *cgreen_journal_reserve(CgreenJournalHeader *journal);
+void cgreen_journal_publish(CgreenJournalRecord *record, CgreenJournalRecordType type);
+
+/* Nothing is done by these unless a journal is kept */
+void start_journal_if_requested(void);
+void journal_test_started(const char *name, const char *file, int line);
+void journal_assertion(int result, CgreenEvent *event);
+void journal_test_finished(uint64_t duration);
+void journal_test_skipped(const char *name, const char *file, int line);
+void journal_test_not_finished(const char *name, const char *file, int line, const char *message);
+
+#ifdef __cplusplus
+    }
+}
+#endif
+
+#endif
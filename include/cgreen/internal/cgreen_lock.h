@@ -0,0 +1,30 @@
+#ifndef CGREEN_LOCK_HEADER
+#define CGREEN_LOCK_HEADER
+
+#ifdef __cplusplus
+namespace cgreen {
+    extern "C" {
+#endif
+
+/* A lock for the state that code under test can reach from threads of
+   its own. The thread holding it can take it again, e.g. from a side
+   effect that calls another mock. Locks are never destroyed, they are
+   only created the first time a test uses threads. */
+typedef struct CgreenLock_ CgreenLock;
+
+CgreenLock *cgreen_lock_create(void);
+void cgreen_lock_take(CgreenLock *lock);
+void cgreen_lock_release(CgreenLock *lock);
+
+#ifdef _MSC_VER
+#define CGREEN_THREAD_LOCAL __declspec(thread)
+#else
+#define CGREEN_THREAD_LOCAL __thread
+#endif
+
+#ifdef __cplusplus
+    }
+}
+#endif
+
+#endif
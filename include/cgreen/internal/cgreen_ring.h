@@ -0,0 +1,32 @@
+#ifndef CGREEN_RING_HEADER
+#define CGREEN_RING_HEADER
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+#ifdef __cplusplus
+namespace cgreen {
+    extern "C" {
+#endif
+
+/* A single producer, single consumer ring buffer in memory that is
+   shared with processes forked after it is opened, so that what a
+   test process has written can be read even if it crashes. A write is
+   either done completely or not at all. */
+typedef struct CgreenRing_ CgreenRing;
+
+CgreenRing *cgreen_ring_open(size_t size);
+void cgreen_ring_close(CgreenRing *ring);
+bool cgreen_ring_write(CgreenRing *ring, const void *header, size_t header_size,
+                       const void *payload, size_t payload_size);
+bool cgreen_ring_wait_for_room(CgreenRing *ring, size_t count, pid_t reader);
+bool cgreen_ring_read(CgreenRing *ring, void *buffer, size_t count);
+bool cgreen_ring_is_empty(CgreenRing *ring);
+
+#ifdef __cplusplus
+    }
+}
+#endif
+
+#endif
@@ -9,8 +9,17 @@ namespace cgreen {
     extern "C" {
 #endif
 
-uint32_t cgreen_time_get_current_milliseconds(void);
-uint32_t cgreen_time_duration_in_milliseconds(uint32_t start_time_in_milliseconds, uint32_t end_time_in_milliseconds);
+/* A monotonic time, only meaningful as the start or end of a duration */
+uint64_t cgreen_time_get_current_nanoseconds(void);
+uint64_t cgreen_time_duration_in_nanoseconds(uint64_t start_time_in_nanoseconds, uint64_t end_time_in_nanoseconds);
+
+#define CGREEN_NANOSECONDS_PER_MILLISECOND 1000000u
+#define CGREEN_NANOSECONDS_PER_SECOND 1000000000u
+
+/* A time in the environment variable is in seconds, or in milliseconds
+   if it ends with "ms". Returns zero if the variable is not set, and
+   dies if it is set to anything but a positive time. */
+unsigned int cgreen_time_milliseconds_from_environment(const char *variable);
 
 #ifdef __cplusplus
     }
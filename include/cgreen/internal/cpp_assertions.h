@@ -10,7 +10,7 @@
 
 namespace cgreen {
 
-#define assert_that_constraint(actual, constraint) assert_that_(__FILE__, __LINE__, STRINGIFY_TOKEN(actual), actual, constraint)
+#define assert_that_constraint(actual, constraint) assert_that_(__FILE__, __LINE__, STRINGIFY_TOKEN(actual), actual, constraint_in_assertion_storage(constraint))
 
     void assert_that_(const char *file, int line, const char *actual_string, const std::string& actual, Constraint *constraint);
     void assert_that_(const char *file, int line, const char *actual_string, const std::string *actual, Constraint *constraint);
@@ -232,4 +232,195 @@
 #define mock63(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50, arg51, arg52, arg53, arg54, arg55, arg56, arg57, arg58, arg59, arg60, arg61, arg62)\
   mock_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49, (intptr_t) arg50, (intptr_t) arg51, (intptr_t) arg52, (intptr_t) arg53, (intptr_t) arg54, (intptr_t) arg55, (intptr_t) arg56, (intptr_t) arg57, (intptr_t) arg58, (intptr_t) arg59, (intptr_t) arg60, (intptr_t) arg61, (intptr_t) arg62)
 
+#define PP_NARG_DOUBLE(...) MOCK_macro_dispatcher(mock_double, __VA_ARGS__)
+
+#define mock_double1(test_reporter, function_name, mock_file, mock_line, arguments_string, ...)\
+    mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t)__VA_ARGS__)
+
+#define mock_double2(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1)
+
+#define mock_double3(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2)
+
+#define mock_double4(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3)
+
+#define mock_double5(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4)
+
+#define mock_double6(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5)
+
+#define mock_double7(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6)
+
+#define mock_double8(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7)
+
+#define mock_double9(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8)
+
+#define mock_double10(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9)
+
+#define mock_double11(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10)
+
+#define mock_double12(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11)
+
+#define mock_double13(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12)
+
+#define mock_double14(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13)
+
+#define mock_double15(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14)
+
+#define mock_double16(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15)
+
+#define mock_double17(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16)
+
+#define mock_double18(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17)
+
+#define mock_double19(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18)
+
+#define mock_double20(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19)
+
+#define mock_double21(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20)
+
+#define mock_double22(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21)
+
+#define mock_double23(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22)
+
+#define mock_double24(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23)
+
+#define mock_double25(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24)
+
+#define mock_double26(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25)
+
+#define mock_double27(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26)
+
+#define mock_double28(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27)
+
+#define mock_double29(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28)
+
+#define mock_double30(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29)
+
+#define mock_double31(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30)
+
+#define mock_double32(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31)
+
+#define mock_double33(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32)
+
+#define mock_double34(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33)
+
+#define mock_double35(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34)
+
+#define mock_double36(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35)
+
+#define mock_double37(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36)
+
+#define mock_double38(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37)
+
+#define mock_double39(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38)
+
+#define mock_double40(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39)
+
+#define mock_double41(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40)
+
+#define mock_double42(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41)
+
+#define mock_double43(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42)
+
+#define mock_double44(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43)
+
+#define mock_double45(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44)
+
+#define mock_double46(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45)
+
+#define mock_double47(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46)
+
+#define mock_double48(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47)
+
+#define mock_double49(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48)
+
+#define mock_double50(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49)
+
+#define mock_double51(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49, (intptr_t) arg50)
+
+#define mock_double52(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50, arg51)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49, (intptr_t) arg50, (intptr_t) arg51)
+
+#define mock_double53(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50, arg51, arg52)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49, (intptr_t) arg50, (intptr_t) arg51, (intptr_t) arg52)
+
+#define mock_double54(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50, arg51, arg52, arg53)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49, (intptr_t) arg50, (intptr_t) arg51, (intptr_t) arg52, (intptr_t) arg53)
+
+#define mock_double55(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50, arg51, arg52, arg53, arg54)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49, (intptr_t) arg50, (intptr_t) arg51, (intptr_t) arg52, (intptr_t) arg53, (intptr_t) arg54)
+
+#define mock_double56(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50, arg51, arg52, arg53, arg54, arg55)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49, (intptr_t) arg50, (intptr_t) arg51, (intptr_t) arg52, (intptr_t) arg53, (intptr_t) arg54, (intptr_t) arg55)
+
+#define mock_double57(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50, arg51, arg52, arg53, arg54, arg55, arg56)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49, (intptr_t) arg50, (intptr_t) arg51, (intptr_t) arg52, (intptr_t) arg53, (intptr_t) arg54, (intptr_t) arg55, (intptr_t) arg56)
+
+#define mock_double58(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50, arg51, arg52, arg53, arg54, arg55, arg56, arg57)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49, (intptr_t) arg50, (intptr_t) arg51, (intptr_t) arg52, (intptr_t) arg53, (intptr_t) arg54, (intptr_t) arg55, (intptr_t) arg56, (intptr_t) arg57)
+
+#define mock_double59(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50, arg51, arg52, arg53, arg54, arg55, arg56, arg57, arg58)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49, (intptr_t) arg50, (intptr_t) arg51, (intptr_t) arg52, (intptr_t) arg53, (intptr_t) arg54, (intptr_t) arg55, (intptr_t) arg56, (intptr_t) arg57, (intptr_t) arg58)
+
+#define mock_double60(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50, arg51, arg52, arg53, arg54, arg55, arg56, arg57, arg58, arg59)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49, (intptr_t) arg50, (intptr_t) arg51, (intptr_t) arg52, (intptr_t) arg53, (intptr_t) arg54, (intptr_t) arg55, (intptr_t) arg56, (intptr_t) arg57, (intptr_t) arg58, (intptr_t) arg59)
+
+#define mock_double61(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50, arg51, arg52, arg53, arg54, arg55, arg56, arg57, arg58, arg59, arg60)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49, (intptr_t) arg50, (intptr_t) arg51, (intptr_t) arg52, (intptr_t) arg53, (intptr_t) arg54, (intptr_t) arg55, (intptr_t) arg56, (intptr_t) arg57, (intptr_t) arg58, (intptr_t) arg59, (intptr_t) arg60)
+
+#define mock_double62(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50, arg51, arg52, arg53, arg54, arg55, arg56, arg57, arg58, arg59, arg60, arg61)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49, (intptr_t) arg50, (intptr_t) arg51, (intptr_t) arg52, (intptr_t) arg53, (intptr_t) arg54, (intptr_t) arg55, (intptr_t) arg56, (intptr_t) arg57, (intptr_t) arg58, (intptr_t) arg59, (intptr_t) arg60, (intptr_t) arg61)
+
+#define mock_double63(test_reporter, function_name, mock_file, mock_line, arguments_string, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20, arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30, arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40, arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50, arg51, arg52, arg53, arg54, arg55, arg56, arg57, arg58, arg59, arg60, arg61, arg62)\
+  mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t) arg0, (intptr_t) arg1, (intptr_t) arg2, (intptr_t) arg3, (intptr_t) arg4, (intptr_t) arg5, (intptr_t) arg6, (intptr_t) arg7, (intptr_t) arg8, (intptr_t) arg9, (intptr_t) arg10, (intptr_t) arg11, (intptr_t) arg12, (intptr_t) arg13, (intptr_t) arg14, (intptr_t) arg15, (intptr_t) arg16, (intptr_t) arg17, (intptr_t) arg18, (intptr_t) arg19, (intptr_t) arg20, (intptr_t) arg21, (intptr_t) arg22, (intptr_t) arg23, (intptr_t) arg24, (intptr_t) arg25, (intptr_t) arg26, (intptr_t) arg27, (intptr_t) arg28, (intptr_t) arg29, (intptr_t) arg30, (intptr_t) arg31, (intptr_t) arg32, (intptr_t) arg33, (intptr_t) arg34, (intptr_t) arg35, (intptr_t) arg36, (intptr_t) arg37, (intptr_t) arg38, (intptr_t) arg39, (intptr_t) arg40, (intptr_t) arg41, (intptr_t) arg42, (intptr_t) arg43, (intptr_t) arg44, (intptr_t) arg45, (intptr_t) arg46, (intptr_t) arg47, (intptr_t) arg48, (intptr_t) arg49, (intptr_t) arg50, (intptr_t) arg51, (intptr_t) arg52, (intptr_t) arg53, (intptr_t) arg54, (intptr_t) arg55, (intptr_t) arg56, (intptr_t) arg57, (intptr_t) arg58, (intptr_t) arg59, (intptr_t) arg60, (intptr_t) arg61, (intptr_t) arg62)
+
 #endif /* MOCK_TABLE_HEADER */
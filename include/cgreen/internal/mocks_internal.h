@@ -27,6 +27,9 @@ extern void never_expect_(TestReporter *test_reporter, const char *function, con
                           ...);
 extern intptr_t mock_(TestReporter *test_reporter, const char *function, const char *mock_file, int mock_line,
                       const char *parameters, ...);
+extern double mock_double_(TestReporter *test_reporter, const char *function, const char *mock_file, int mock_line,
+                           const char *parameters, ...);
+extern int number_of_calls_to_(const char *function);
 
 
 /* Warning for unused results from 'when()' helps detecting slip-ups in the expect():
@@ -3,6 +3,7 @@
 
 #include <cgreen/suite.h>
 #include <cgreen/reporter.h>
+#include <stdbool.h>
 
 #ifdef __cplusplus
 namespace cgreen {
@@ -11,8 +12,24 @@ namespace cgreen {
 
 void run_specified_test_if_child(TestSuite *suite, TestReporter *reporter);
 void run_test_in_its_own_process(TestSuite *suite, CgreenTest *test, TestReporter *reporter);
+void run_tests_in_parallel_processes(TestSuite *suite, CgreenTest **tests, int count,
+                                     TestReporter *reporter, int jobs);
+void run_tests_in_worker_pool(TestSuite *suite, CgreenTest **tests, int count,
+                              TestReporter *reporter, int workers, bool retire_when_dirty);
+void run_tests_in_library_worker(TestSuite *suite, CgreenTest **tests, int count,
+                                 TestReporter *reporter);
+void run_setup_in_library_worker(void (*setup)(void));
+void run_teardown_in_library_worker(void (*teardown)(void));
+void stop_library_worker(void);
+void start_watchdog_in_this_process(CgreenTest *test, unsigned int timeout);
+void stop_watchdog_in_this_process(void);
+void start_resource_measurement_in_this_process(void);
+void finish_resource_measurement_in_this_process(CgreenResourceUsage *usage);
+void start_counting_allocations_in_this_test(void);
+void finish_counting_allocations_in_this_test(CgreenTest *test, TestReporter *reporter);
 void die(const char *message, ...);
 void run_the_test_code(TestSuite *suite, CgreenTest *spec, TestReporter *reporter);
+unsigned int timeout_for(TestSuite *suite, CgreenTest *test);
 
 #ifdef __cplusplus
     }
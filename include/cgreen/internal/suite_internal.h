@@ -25,6 +25,9 @@ struct TestSuite_ {
 	void (*setup)(void);
 	void (*teardown)(void);
 	int size;
+	void (*before_all)(void);
+	void (*after_all)(void);
+	unsigned int timeout;
 };
 
 #ifdef __cplusplus
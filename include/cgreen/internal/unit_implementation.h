@@ -22,6 +22,7 @@ typedef struct {
     void(*run)(void);
     const char* filename;
     int line;
+    unsigned int timeout;     /* In milliseconds, 0 if not overridden */
 } CgreenTest;
 
 #define CGREEN_SPEC_PREFIX "CgreenSpec"
@@ -42,19 +43,52 @@ typedef struct {
 #define ENSURE_macro_dispatcher___(func, nargs)          func ## nargs
 
 #define Ensure_NARG(...) ENSURE_macro_dispatcher(Ensure, __VA_ARGS__)
+#define EnsureWithin_NARG(...) ENSURE_macro_dispatcher(EnsureWithin, __VA_ARGS__)
 
-#define EnsureWithContextAndSpecificationName(skip, contextName, specName) \
+#define SpecificationWithContext(skip, timeout, contextName, specName) \
     static void contextName##__##specName (void);\
-    CgreenTest spec_name(contextName, specName) = { skip, &contextFor##contextName, STRINGIFY_TOKEN(specName), &contextName##__##specName, __FILE__, __LINE__ }; \
+    CgreenTest spec_name(contextName, specName) = { skip, &contextFor##contextName, STRINGIFY_TOKEN(specName), &contextName##__##specName, __FILE__, __LINE__, timeout }; \
     static void contextName##__##specName (void)
 
 extern CgreenContext defaultContext;
 
-#define EnsureWithSpecificationName(skip, specName) \
+#define Specification(skip, timeout, specName) \
     static void specName (void);\
-    CgreenTest spec_name(default, specName) = { skip, &defaultContext, STRINGIFY_TOKEN(specName), &specName, __FILE__, __LINE__ }; \
+    CgreenTest spec_name(default, specName) = { skip, &defaultContext, STRINGIFY_TOKEN(specName), &specName, __FILE__, __LINE__, timeout }; \
     static void specName (void)
 
+#define EnsureWithContextAndSpecificationName(skip, contextName, specName) \
+    SpecificationWithContext(skip, 0, contextName, specName)
+
+#define EnsureWithSpecificationName(skip, specName) \
+    Specification(skip, 0, specName)
+
+#define EnsureWithinWithContextAndSpecificationName(milliseconds, contextName, specName) \
+    SpecificationWithContext(0, milliseconds, contextName, specName)
+
+#define EnsureWithinWithSpecificationName(milliseconds, specName) \
+    Specification(0, milliseconds, specName)
+
+#define Benchmark_NARG(...) ENSURE_macro_dispatcher(Benchmark, __VA_ARGS__)
+
+/* A benchmark is a test that runs its body, which is given the
+   CgreenBenchmark as 'benchmark', through run_benchmark(). It is
+   named as tests are on the cgreen-runner command line. */
+#define BenchmarkWithContextAndSpecificationName(skip, contextName, specName) \
+    static void contextName##__##specName##_Benchmark(CgreenBenchmark *benchmark); \
+    SpecificationWithContext(skip, 0, contextName, specName) {          \
+        run_benchmark(&contextName##__##specName##_Benchmark,           \
+                      STRINGIFY_TOKEN(contextName) ":" STRINGIFY_TOKEN(specName), __FILE__, __LINE__); \
+    }                                                                   \
+    static void contextName##__##specName##_Benchmark(CgreenBenchmark *benchmark)
+
+#define BenchmarkWithSpecificationName(skip, specName) \
+    static void specName##_Benchmark(CgreenBenchmark *benchmark);      \
+    Specification(skip, 0, specName) {                                  \
+        run_benchmark(&specName##_Benchmark, STRINGIFY_TOKEN(specName), __FILE__, __LINE__); \
+    }                                                                   \
+    static void specName##_Benchmark(CgreenBenchmark *benchmark)
+
 #define DescribeImplementation(subject) \
         static void setup(void);                \
         static void teardown(void);                                     \
@@ -79,4 +113,26 @@ extern CgreenContext defaultContext;
         void(*AfterEach_For_##subject)(void) = &AfterEach_For_##subject##_Function; \
         static void AfterEach_For_##subject##_Function(void)
 
+/* BeforeAll and AfterAll are optional so Describe can't refer to
+   them. Instead the runner looks them up by name, which is why they
+   are named by CGREEN_BEFORE_ALL_PREFIX/CGREEN_AFTER_ALL_PREFIX */
+#define CGREEN_BEFORE_ALL_PREFIX "BeforeAll_For_"
+#define CGREEN_AFTER_ALL_PREFIX "AfterAll_For_"
+
+#define BeforeAllImplementation(subject) \
+        static void BeforeAll_For_##subject##_Function(void);           \
+        void(*BeforeAll_For_##subject)(void) = &BeforeAll_For_##subject##_Function; \
+        static void BeforeAll_For_##subject##_Function(void)
+
+#define AfterAllImplementation(subject) \
+        static void AfterAll_For_##subject##_Function(void);            \
+        void(*AfterAll_For_##subject)(void) = &AfterAll_For_##subject##_Function; \
+        static void AfterAll_For_##subject##_Function(void)
+
+/* Also optional, so looked up by name in the same way */
+#define CGREEN_TIMEOUT_PREFIX "Timeout_For_"
+
+#define TimeoutImplementation(subject, milliseconds) \
+        unsigned int Timeout_For_##subject = (milliseconds)
+
 #endif
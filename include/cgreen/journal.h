@@ -0,0 +1,81 @@
+#ifndef JOURNAL_HEADER
+#define JOURNAL_HEADER
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+namespace cgreen {
+    extern "C" {
+#endif
+
+/* A journal is a file that the results of a run are written straight
+   into, as they happen, by every process of the run. A test process
+   that crashes or is killed has still written everything up to that
+   point, including where its last assertion was, so the journal can be
+   read, during or after the run, to tell what happened.
+
+   The file starts with a header, followed by fixed size records. A
+   record is reserved by atomically counting up the tail in the header,
+   and its type is written last, so that a record of type
+   CGREEN_JOURNAL_UNWRITTEN was never finished. The tail goes on
+   counting when the journal is full, but those records are lost. */
+
+#define CGREEN_JOURNAL_MAGIC "CGREENJ"
+#define CGREEN_JOURNAL_VERSION 1
+#define CGREEN_JOURNAL_RECORD_SIZE 1024
+#define CGREEN_JOURNAL_NAME_SIZE 128
+#define CGREEN_JOURNAL_MESSAGE_SIZE 592
+
+typedef enum {
+    CGREEN_JOURNAL_UNWRITTEN = 0,
+    CGREEN_JOURNAL_TEST,          /* Written when the test starts, and kept up to date */
+    CGREEN_JOURNAL_FAILURE,
+    CGREEN_JOURNAL_SKIPPED,
+    CGREEN_JOURNAL_INCOMPLETE     /* Written by the parent when the test process never finished */
+} CgreenJournalRecordType;
+
+typedef enum {
+    CGREEN_JOURNAL_RUNNING = 0,
+    CGREEN_JOURNAL_COMPLETED,
+    CGREEN_JOURNAL_NOT_COMPLETED
+} CgreenJournalOutcome;
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t capacity;            /* Records, not counting the header */
+    uint64_t tail;                /* Records reserved */
+    uint64_t started;             /* Monotonic nanoseconds when the journal was created */
+} CgreenJournalHeader;
+
+typedef struct {
+    uint32_t type;
+    int32_t pid;
+    uint64_t time;                /* Nanoseconds since the journal was created */
+    int32_t line;
+    uint32_t outcome;             /* Of a test */
+    uint64_t passes;              /* Of a test, so far */
+    uint64_t duration;            /* Of a completed test, in nanoseconds */
+    int32_t last_line;            /* Of the latest assertion of a test */
+    uint32_t reserved;
+    char name[CGREEN_JOURNAL_NAME_SIZE];
+    char file[CGREEN_JOURNAL_NAME_SIZE];
+    char last_file[CGREEN_JOURNAL_NAME_SIZE];
+    char message[CGREEN_JOURNAL_MESSAGE_SIZE];
+} CgreenJournalRecord;
+
+/* Keep a journal of the run in the file, which is created anew. Can
+   also be set by the CGREEN_JOURNAL environment variable. It has to
+   be done before any tests are run. */
+void keep_journal_in(const char *filename);
+
+/* Print the records of a journal, returns zero if it can't be read */
+int print_journal(const char *filename);
+
+#ifdef __cplusplus
+    }
+}
+#endif
+
+#endif
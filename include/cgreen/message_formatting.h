@@ -13,6 +13,12 @@ char *failure_message_for(Constraint *constraint, const char *actual_string, int
 char *validation_failure_message_for(Constraint *constraint, intptr_t actual);
 bool parameters_are_not_valid_for(Constraint *constraint, intptr_t actual);
 
+/* Kept until the next test, and not to be used as a format */
+const char *failure_message_in_this_test_for(Constraint *constraint, const char *actual_string, intptr_t actual);
+void forget_failure_messages_of_this_test(void);
+/* Until the next test, for tests that assert from threads of their own */
+void lock_failure_messages_of_threads(void);
+
 #ifdef __cplusplus
 }
 }
@@ -1,6 +1,8 @@
 #ifndef MESSAGING_HEADER
 #define MESSAGING_HEADER
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 namespace cgreen {
     extern "C" {
@@ -9,6 +11,14 @@ namespace cgreen {
 int start_cgreen_messaging(int tag);
 void send_cgreen_message(int messaging, int result);
 int receive_cgreen_message(int messaging);
+void send_cgreen_message_with_payload(int messaging, int result, const void *payload, size_t size);
+int receive_cgreen_message_with_payload(int messaging, void **payload, size_t *size);
+void redirect_cgreen_messaging(int messaging, int readfd, int writefd);
+void restore_cgreen_messaging(int messaging);
+int get_cgreen_messaging_wakeup(int messaging);
+void clear_cgreen_messaging_wakeup(int messaging);
+void notify_cgreen_messaging_reader(int messaging);
+void drain_cgreen_messaging_with(int messaging, void (*drain)(void *reader), void *reader);
 int get_pipe_read_handle(void);
 int get_pipe_write_handle(void);
 
@@ -29,19 +29,33 @@ namespace cgreen {
 // another workaround for fundamental variadic macro deficiencies in Visual C++ 2012
 #define mock(...) PP_NARG(__VA_ARGS__)(get_test_reporter(), __func__, __FILE__, __LINE__, #__VA_ARGS__ "", \
                                        __VA_ARGS__)
+#define mock_double(...) PP_NARG_DOUBLE(__VA_ARGS__)(get_test_reporter(), __func__, __FILE__, __LINE__, \
+                                                     #__VA_ARGS__ "", __VA_ARGS__)
 #else
 #define mock(...) PP_NARG(__VA_ARGS__)(get_test_reporter(), __func__, __FILE__, __LINE__, #__VA_ARGS__ "", \
                                        __VA_ARGS__ +0)
+#define mock_double(...) PP_NARG_DOUBLE(__VA_ARGS__)(get_test_reporter(), __func__, __FILE__, __LINE__, \
+                                                     #__VA_ARGS__ "", __VA_ARGS__ +0)
 #endif
 
 #define when(parameter, constraint) when_(#parameter, constraint)
 
 #define times(number_times_called) times_(number_times_called)
 
+/* The number of calls made to a mocked function in this test, whether
+   they were expected or not */
+#define number_of_calls_to(f) number_of_calls_to_(STRINGIFY_TOKEN(f))
+
 /* Make Cgreen mocks strict, loose or learning */
 typedef enum { strict_mocks = 0, loose_mocks = 1, learning_mocks = 2 } CgreenMockMode;
 extern void cgreen_mocks_are(CgreenMockMode mode);
 
+/* For a test whose code calls mocks, or asserts, from threads of its
+   own. Call it before those threads are started, and join them before
+   the test ends. The mocks are then locked, and what the other threads
+   assert is shown when the test is over. */
+extern void cgreen_test_uses_threads(void);
+
 extern const int UNLIMITED_TIME_TO_LIVE;
 
 #ifdef __cplusplus
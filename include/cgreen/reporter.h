@@ -5,7 +5,68 @@
 #include <stdint.h>
 #include <cgreen/breadcrumb.h>
 
+/* What the setup, test and teardown allocated, only counted where
+   the allocation functions can be intercepted */
+typedef struct {
+    int counted;
+    uint64_t allocations;
+    uint64_t bytes;                 /* In total */
+    uint64_t peak_bytes;            /* Allocated at the same time */
+    int64_t unfreed_allocations;    /* Negative if more was freed */
+    int64_t unfreed_bytes;
+} CgreenAllocationUsage;
+
+/* What the process running a test used, only measured when the test
+   was run in a process of its own, or in a reused one */
+typedef struct {
+    int measured;
+    uint64_t user_time;         /* In nanoseconds */
+    uint64_t system_time;       /* In nanoseconds */
+    long max_resident_set_size; /* In kilobytes */
+    long major_page_faults;
+    long minor_page_faults;
+    long voluntary_context_switches;
+    long involuntary_context_switches;
+    CgreenAllocationUsage allocations;
+} CgreenResourceUsage;
+
+#define CGREEN_BENCHMARK_SAMPLES 100
+
+/* Per iteration, over all samples taken of a benchmark */
+typedef struct {
+    uint64_t iterations;        /* In each sample */
+    int samples;
+    double minimum;             /* All in nanoseconds */
+    double median;
+    double mean;
+    double percentile_99;
+    double standard_deviation;
+    double sample_times[CGREEN_BENCHMARK_SAMPLES]; /* Sorted */
+} CgreenBenchmarkStatistics;
+
+/* What is shown of an assertion, or of a test that did not complete.
+   The message is only formatted when a reporter asks for it with
+   cgreen_event_message(), so an event that no reporter looks at costs
+   nothing to show. What else is known about an assertion is there
+   too, otherwise those fields are NULL. */
+typedef struct {
+    const char *file;
+    int line;
+    const char *constraint;     /* The name of the constraint */
+    const char *expression;     /* The actual value, as written in the test */
+    const char *expected;       /* The expected value, as written in the test */
+    const char *format;         /* Of the message, with its arguments */
+    va_list *arguments;
+    const char *message;        /* Once formatted, or if it already was */
+    char *formatted;
+} CgreenEvent;
+
 typedef struct TestReporter_ TestReporter;
+
+/* A reporter gets the events through the report functions, unless
+   it overrides the show functions that get the message and its
+   arguments. Passes, failures and incomplete tests are shown through
+   either, skips and benchmarks only through the show functions. */
 struct TestReporter_ {
     void (*destroy)(TestReporter *reporter);
     void (*start_suite)(TestReporter *reporter, const char *name, const int count);
@@ -26,16 +87,29 @@ struct TestReporter_ {
     int failures;
     int exceptions;
     int skips;
-    uint32_t duration;
+    uint32_t duration;          /* In milliseconds */
     int total_passes;
     int total_failures;
     int total_exceptions;
     int total_skips;
-    uint32_t total_duration;
+    uint32_t total_duration;    /* In milliseconds */
     CgreenBreadcrumb *breadcrumb;
     int ipc;
     void *memo;
     void *options;
+    /* Added after the others, so that reporters built against them still work */
+    CgreenResourceUsage resource_usage;
+    void (*show_benchmark)(TestReporter *reporter, const char *file, int line,
+                           const CgreenBenchmarkStatistics *statistics);
+    int drained_status;         /* How the test finished, if already drained */
+    int summarize_passes;       /* Send a count of the passes instead of each one */
+    int unsent_passes;
+    void (*report_pass)(TestReporter *reporter, CgreenEvent *event);
+    void (*report_fail)(TestReporter *reporter, CgreenEvent *event);
+    void (*report_incomplete)(TestReporter *reporter, CgreenEvent *event);
+    int *shared_unsent_passes;  /* Counted there instead, in a test process */
+    uint64_t duration_ns;       /* The durations above, in nanoseconds */
+    uint64_t total_duration_ns;
 };
 
 typedef void TestReportMemo;
@@ -51,14 +125,27 @@ void set_reporter_options(TestReporter *reporter, void *options);
 void setup_reporting(TestReporter *reporter);
 void destroy_reporter(TestReporter *reporter);
 void destroy_memo(TestReportMemo *memo);
+void defer_reporter_output(TestReporter *reporter);
 void reporter_start_test(TestReporter *reporter, const char *name);
 void reporter_start_suite(TestReporter *reporter, const char *name, const int count);
 void reporter_finish_test(TestReporter *reporter, const char *filename, int line, const char *message);
 void reporter_finish_suite(TestReporter *reporter, const char *filename, int line);
+void reporter_show_assertion(TestReporter *reporter, int result, CgreenEvent *event,
+                             const char *format, ...);
+void reporter_show_incomplete(TestReporter *reporter, CgreenEvent *event);
+const char *cgreen_event_message(CgreenEvent *event);
+void drain_reporter_results(TestReporter *reporter);
+void drain_reporter_results_in_this_process(TestReporter *reporter);
 void add_reporter_result(TestReporter *reporter, int result);
+void flush_reporter_results(TestReporter *reporter);
+void count_unsent_passes_in(TestReporter *reporter, int *counter);
 void send_reporter_exception_notification(TestReporter *reporter);
 void send_reporter_skipped_notification(TestReporter *reporter);
 void send_reporter_completion_notification(TestReporter *reporter);
+void send_reporter_duration(TestReporter *reporter, uint64_t duration);
+void send_reporter_allocation_usage(TestReporter *reporter, const CgreenAllocationUsage *usage);
+void keep_assertions_of_other_threads(void);
+void show_assertions_of_other_threads(TestReporter *reporter);
 
 #ifdef __cplusplus
     }
@@ -9,9 +9,18 @@ namespace cgreen {
     extern "C" {
 #endif
 
+/* How many tests share a process, a crash only affects the tests in it */
+typedef enum {
+    isolate_tests,
+    isolate_contexts,
+    isolate_library
+} CgreenIsolation;
+
 
 int run_test_suite(TestSuite *suite, TestReporter *reporter);
+int run_test_suite_parallel(TestSuite *suite, TestReporter *reporter, int jobs);
 int run_single_test(TestSuite *suite, const char *test, TestReporter *reporter);
+void set_test_isolation(CgreenIsolation isolation);
 void die_in(unsigned int seconds);
 
 #ifdef __cplusplus
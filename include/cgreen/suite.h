@@ -25,6 +25,9 @@ namespace cgreen {
 
 void set_setup(TestSuite *suite, void (*set_up)(void));
 void set_teardown(TestSuite *suite, void (*tear_down)(void));
+void set_before_all(TestSuite *suite, void (*before_all)(void));
+void set_after_all(TestSuite *suite, void (*after_all)(void));
+void set_test_timeout(TestSuite *suite, unsigned int milliseconds);
 int count_tests(TestSuite *suite);
 bool has_test(TestSuite *suite, const char *name);
 bool has_setup(TestSuite *suite);
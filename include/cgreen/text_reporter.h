@@ -17,6 +17,7 @@ typedef struct text_reporter_options {
     bool quiet_mode;
     bool inhibit_start_suite_message;
     bool inhibit_finish_suite_message;
+    bool verbose_mode;          /* Report duration and resource usage of each test */
 } TextReporterOptions;
 
 TestReporter *create_text_reporter(void);
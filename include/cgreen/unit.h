@@ -20,10 +20,28 @@ namespace cgreen {
 /* NOTE if you use BDD style all three of the above are required */
 /* Then you must also use the BDD style Ensure(subject, test) */
 
+/* BDD style: Run this once in the main process before the tests in that
+   context are run, and thus forked, so they all share the result.
+   Optional, found by the cgreen-runner, otherwise use set_before_all() */
+#define BeforeAll(subject) BeforeAllImplementation(subject)
+
+/* BDD style: Run this once in the main process after all tests in that
+   context have been run. Optional, found by the cgreen-runner,
+   otherwise use set_after_all() */
+#define AfterAll(subject) AfterAllImplementation(subject)
+
+/* BDD style: Kill and fail any test in that context running longer
+   than this. Optional, found by the cgreen-runner, otherwise use
+   set_test_timeout() */
+#define Timeout(subject, milliseconds) TimeoutImplementation(subject, milliseconds)
+
 /* TDD Style: Ensure(testname) {implementation} */
 /* BDD Style: Ensure(subject, testname) {implementation} */
 #define Ensure(...) Ensure_NARG(0, __VA_ARGS__)(0, __VA_ARGS__)
 
+/* As Ensure() but kill and fail the test if it runs longer than this */
+#define EnsureWithin(milliseconds, ...) EnsureWithin_NARG(milliseconds, __VA_ARGS__)(milliseconds, __VA_ARGS__)
+
 /* Temporarily ignore this test */
 #define xEnsure(...) Ensure_NARG(1, __VA_ARGS__)(1, __VA_ARGS__)
 
@@ -0,0 +1,147 @@
+#include <cgreen/allocations.h>
+#include <cgreen/reporter.h>
+#include <cgreen/internal/cgreen_allocation_counter.h>
+#include <cgreen/internal/runner_platform.h>
+#ifndef __cplusplus
+#include <stdbool.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+
+static const char* CGREEN_COUNT_ALLOCATIONS_ENVIRONMENT_VARIABLE = "CGREEN_COUNT_ALLOCATIONS";
+static const char* CGREEN_NO_NET_ALLOCATIONS_ENVIRONMENT_VARIABLE = "CGREEN_NO_NET_ALLOCATIONS";
+
+/* Nothing can be counted unless the cgreen_allocations library has
+   replaced the allocation functions, and then nothing is counted
+   unless asked for */
+static const CgreenAllocationCounter *counter = NULL;
+static bool counting_whole_test = false;
+static bool counting_only_during_expression = false;
+static bool net_allocations_allowed = true;
+static CgreenAllocationUsage counted_before_expression;
+static const char *expression_counted = NULL;
+
+static bool is_counting(void);
+static void stop_counting(void);
+static void read_counted(CgreenAllocationUsage *counted);
+
+
+void count_allocations_with(const CgreenAllocationCounter *allocation_counter) {
+    counter = allocation_counter;
+}
+
+bool allocations_can_be_counted(void) {
+    return counter != NULL;
+}
+
+static void start_counting(bool only_during_expression) {
+    counting_only_during_expression = only_during_expression;
+    if (counter != NULL)
+        (*counter->start)();
+}
+
+/* What was allocated before this is not counted, and neither is
+   freeing it */
+void expect_no_net_allocations(void) {
+    net_allocations_allowed = false;
+    if (!counting_whole_test) {
+        counting_whole_test = true;
+        start_counting(false);
+    }
+}
+
+/* Counting is often already going on for the whole test, if not
+   it is only done for the expression */
+void start_counting_allocations_during(void) {
+    expression_counted = NULL;
+    if (!is_counting())
+        start_counting(true);
+    read_counted(&counted_before_expression);
+}
+
+static void stop_counting_after_expression(const char *expression) {
+    if (counting_only_during_expression) {
+        stop_counting();
+        counting_only_during_expression = false;
+    }
+    expression_counted = expression;
+}
+
+intptr_t allocations_counted_during(const char *expression) {
+    CgreenAllocationUsage counted;
+
+    read_counted(&counted);
+    stop_counting_after_expression(expression);
+    return (intptr_t)(counted.allocations - counted_before_expression.allocations);
+}
+
+intptr_t bytes_allocated_counted_during(const char *expression) {
+    CgreenAllocationUsage counted;
+
+    read_counted(&counted);
+    stop_counting_after_expression(expression);
+    return (intptr_t)(counted.bytes - counted_before_expression.bytes);
+}
+
+/* An assertion would otherwise show what allocations_during() expands
+   to, so if the actual value was counted by one it shows what it was
+   written as instead */
+const char *expression_of_counted_allocations(const char *actual_string) {
+    const char *counted_during = strstr(actual_string, "_counted_during(");
+    const char *expression = expression_counted;
+
+    expression_counted = NULL;
+    if (expression == NULL || counted_during == NULL
+        || strstr(counted_during + 1, "_counted_during(") != NULL)
+        return actual_string;
+    return expression;
+}
+
+void start_counting_allocations_in_this_test(void) {
+    net_allocations_allowed = getenv(CGREEN_NO_NET_ALLOCATIONS_ENVIRONMENT_VARIABLE) == NULL;
+    counting_whole_test = !net_allocations_allowed
+        || getenv(CGREEN_COUNT_ALLOCATIONS_ENVIRONMENT_VARIABLE) != NULL;
+    expression_counted = NULL;
+    if (counting_whole_test)
+        start_counting(false);
+}
+
+/* The counts are sent to be reported with the rest of what the test
+   used, since the test might be run in a process of its own */
+void finish_counting_allocations_in_this_test(CgreenTest *test, TestReporter *reporter) {
+    CgreenAllocationUsage usage;
+
+    stop_counting();
+    read_counted(&usage);
+    usage.counted = allocations_can_be_counted() && counting_whole_test;
+    counting_whole_test = false;
+
+    if (usage.counted && !net_allocations_allowed
+        && (usage.unfreed_allocations > 0 || usage.unfreed_bytes > 0)) {
+        (*reporter->assert_true)(reporter, test->filename, test->line, false,
+                                 "Expected everything allocated by the test to be freed\n"
+                                 "\t\tunfreed allocations: [%ld]\n"
+                                 "\t\tunfreed bytes: [%ld]",
+                                 (long)usage.unfreed_allocations, (long)usage.unfreed_bytes);
+    }
+    send_reporter_allocation_usage(reporter, &usage);
+}
+
+
+static bool is_counting(void) {
+    return counter != NULL && (*counter->is_counting)();
+}
+
+static void stop_counting(void) {
+    if (counter != NULL)
+        (*counter->stop)();
+}
+
+static void read_counted(CgreenAllocationUsage *counted) {
+    if (counter != NULL)
+        (*counter->read)(counted);
+    else
+        memset(counted, 0, sizeof(*counted));
+}
+
+/* vim: set ts=4 sw=4 et cindent: */
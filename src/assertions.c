@@ -1,3 +1,4 @@
+#include <cgreen/allocations.h>
 #include <cgreen/assertions.h>
 #include <cgreen/boxed_double.h>
 #include <cgreen/constraint_syntax_helpers.h>
@@ -19,11 +20,23 @@
 
 const char *show_null_as_the_string_null(const char *string);
 
+static void describe_assertion(CgreenEvent *event, const char *file, int line,
+                               const char *expression, Constraint *constraint) {
+    memset(event, 0, sizeof(*event));
+    event->file = file;
+    event->line = line;
+    event->constraint = constraint->name;
+    event->expression = expression;
+    event->expected = constraint->expected_value_name;
+}
 
 void assert_core_(const char *file, int line, const char *actual_string, intptr_t actual,
                   Constraint* constraint) {
 
-    char *failure_message;
+    CgreenEvent event;
+
+    /* in case the constraint didn't use the storage of the assertion */
+    forget_storage_for_next_constraint();
 
     if (NULL != constraint && is_not_comparing(constraint)) {
         (*get_test_reporter()->assert_true)(
@@ -66,22 +79,16 @@ void assert_core_(const char *file, int line, const char *actual_string, intptr_
         return;
     }
 
-    failure_message = constraint->failure_message(constraint, actual_string, actual);
-
-    (*get_test_reporter()->assert_true)(
-                                        get_test_reporter(),
-                                        file,
-                                        line,
-                                        (*constraint->compare)(constraint, make_cgreen_integer_value(actual)),
-                                        failure_message
-                                        );
+    describe_assertion(&event, file, line, expression_of_counted_allocations(actual_string), constraint);
+    show_comparison(get_test_reporter(), &event, constraint, make_cgreen_integer_value(actual));
 
     constraint->destroy(constraint);
-    free(failure_message);
 }
 
 void assert_that_double_(const char *file, int line, const char *expression, double actual, Constraint* constraint) {
-    BoxedDouble* boxed_actual;
+    CgreenEvent event;
+
+    forget_storage_for_next_constraint();
 
     if (NULL != constraint && is_not_comparing(constraint)) {
         (*get_test_reporter()->assert_true)(
@@ -109,10 +116,10 @@ void assert_that_double_(const char *file, int line, const char *expression, dou
                 constraint->name);
     }
 
-    boxed_actual = (BoxedDouble*)box_double(actual);
-
-    (*get_test_reporter()->assert_true)(get_test_reporter(), file, line,
+    describe_assertion(&event, file, line, expression, constraint);
+    reporter_show_assertion(get_test_reporter(),
             (*constraint->compare)(constraint, make_cgreen_double_value(actual)),
+            &event,
             "Expected [%s] to [%s] [%s] within [%d] significant figures\n"
             "\t\tactual value:\t\t\t[%08f]\n"
             "\t\texpected value:\t\t\t[%08f]",
@@ -123,7 +130,6 @@ void assert_that_double_(const char *file, int line, const char *expression, dou
             actual,
             constraint->expected_value.value.double_value);
 
-    free(boxed_actual);
     constraint->destroy(constraint);
 }
 
@@ -0,0 +1,385 @@
+#include <cgreen/benchmark.h>
+#include <cgreen/reporter.h>
+#include <cgreen/internal/cgreen_time.h>
+#include <cgreen/internal/runner_platform.h>
+#ifndef __cplusplus
+#include <stdbool.h>
+#endif
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __ANDROID__
+#include "cgreen/internal/android_headers/androidcompat.h"
+#endif // #ifdef __ANDROID__
+
+struct CgreenBenchmark_ {
+    uint64_t iterations;
+    bool timing;
+    uint64_t resumed;           /* When timing was last resumed */
+    uint64_t elapsed;           /* Timed nanoseconds before that */
+};
+
+static const char* CGREEN_BENCHMARK_TIME_ENVIRONMENT_VARIABLE = "CGREEN_BENCHMARK_TIME";
+static const char* CGREEN_BENCHMARK_BASELINE_ENVIRONMENT_VARIABLE = "CGREEN_BENCHMARK_BASELINE";
+static const char* CGREEN_BENCHMARK_THRESHOLD_ENVIRONMENT_VARIABLE = "CGREEN_BENCHMARK_THRESHOLD";
+
+/* The time is spent on taking CGREEN_BENCHMARK_SAMPLES samples, after
+   a tenth of that many samples has been run to warm up caches and
+   branch predictors */
+#define MINIMUM_BENCHMARK_SAMPLES 5
+#define DEFAULT_BENCHMARK_MILLISECONDS 500
+#define MAXIMUM_BENCHMARK_ITERATIONS 1000000000ull
+
+/* A regression has to be this unlikely to be by chance to be reported */
+#define REGRESSION_SIGNIFICANCE 0.01
+#define DEFAULT_REGRESSION_THRESHOLD 10.0
+
+static char *baseline_to_compare_with = NULL;
+static double regression_threshold = DEFAULT_REGRESSION_THRESHOLD;
+static char *baseline_to_save_in = NULL;
+
+static uint64_t benchmark_time_from_environment(void);
+static uint64_t calibrate_iterations(void (*body)(CgreenBenchmark *), uint64_t sample_time,
+                                     uint64_t *elapsed);
+static uint64_t time_iterations(void (*body)(CgreenBenchmark *), uint64_t iterations);
+static void calculate_statistics(CgreenBenchmarkStatistics *statistics, int samples);
+static void compare_with_baseline(TestReporter *reporter, const char *name, const char *filename, int line,
+                                  const CgreenBenchmarkStatistics *statistics);
+static void save_in_baseline(const char *name, const CgreenBenchmarkStatistics *statistics);
+
+
+uint64_t benchmark_iterations(CgreenBenchmark *benchmark) {
+    return benchmark->iterations;
+}
+
+void pause_benchmark_timing(CgreenBenchmark *benchmark) {
+    if (benchmark->timing) {
+        benchmark->elapsed += cgreen_time_get_current_nanoseconds() - benchmark->resumed;
+        benchmark->timing = false;
+    }
+}
+
+void resume_benchmark_timing(CgreenBenchmark *benchmark) {
+    if (!benchmark->timing) {
+        benchmark->timing = true;
+        benchmark->resumed = cgreen_time_get_current_nanoseconds();
+    }
+}
+
+static const void *volatile benchmark_sink;
+
+void benchmark_use(const void *value) {
+    benchmark_sink = value;
+}
+
+void compare_benchmarks_with_baseline(const char *filename, double threshold) {
+    free(baseline_to_compare_with);
+    baseline_to_compare_with = filename != NULL ? strdup(filename) : NULL;
+    regression_threshold = threshold;
+}
+
+/* The benchmarks might be run in other processes, so each result is
+   appended to the file as it is written */
+void save_benchmarks_as_baseline(const char *filename) {
+    FILE *baseline = fopen(filename, "w");
+
+    if (baseline == NULL) {
+        die("Could not create benchmark baseline file: %s\n", filename);
+    }
+    fclose(baseline);
+    free(baseline_to_save_in);
+    baseline_to_save_in = strdup(filename);
+}
+
+/* Calibrate the number of iterations so that a sample takes long
+   enough to be measured with good precision, and then report the time
+   per iteration over all samples */
+void run_benchmark(void (*body)(CgreenBenchmark *benchmark), const char *name,
+                   const char *filename, int line) {
+    TestReporter *reporter = get_test_reporter();
+    uint64_t benchmark_time = benchmark_time_from_environment();
+    uint64_t sample_time = benchmark_time / CGREEN_BENCHMARK_SAMPLES;
+    CgreenBenchmarkStatistics statistics;
+    uint64_t iterations, elapsed;
+    int samples, i;
+
+    iterations = calibrate_iterations(body, sample_time, &elapsed);
+
+    /* Slow bodies get fewer samples, but not so few that there are no statistics */
+    samples = CGREEN_BENCHMARK_SAMPLES;
+    if (iterations == 1 && elapsed > sample_time) {
+        samples = (int)(benchmark_time / elapsed);
+        if (samples < MINIMUM_BENCHMARK_SAMPLES)
+            samples = MINIMUM_BENCHMARK_SAMPLES;
+    }
+
+    for (i = 0; i < samples / 10; i++)
+        time_iterations(body, iterations);
+
+    memset(&statistics, 0, sizeof(statistics));
+    for (i = 0; i < samples; i++)
+        statistics.sample_times[i] = (double)time_iterations(body, iterations) / (double)iterations;
+
+    statistics.iterations = iterations;
+    calculate_statistics(&statistics, samples);
+
+    (*reporter->show_benchmark)(reporter, filename, line, &statistics);
+    if (baseline_to_save_in != NULL)
+        save_in_baseline(name, &statistics);
+    compare_with_baseline(reporter, name, filename, line, &statistics);
+}
+
+static uint64_t benchmark_time_from_environment(void) {
+    unsigned int milliseconds = cgreen_time_milliseconds_from_environment(CGREEN_BENCHMARK_TIME_ENVIRONMENT_VARIABLE);
+
+    if (milliseconds == 0) {
+        milliseconds = DEFAULT_BENCHMARK_MILLISECONDS;
+    }
+    return (uint64_t)milliseconds * CGREEN_NANOSECONDS_PER_MILLISECOND;
+}
+
+/* Grow the number of iterations, guessing from the time of the last
+   try, but not too fast since the first tries are the least reliable */
+static uint64_t calibrate_iterations(void (*body)(CgreenBenchmark *), uint64_t sample_time,
+                                     uint64_t *elapsed) {
+    uint64_t iterations = 1;
+
+    for (;;) {
+        uint64_t next;
+
+        *elapsed = time_iterations(body, iterations);
+        if (*elapsed >= sample_time || iterations >= MAXIMUM_BENCHMARK_ITERATIONS)
+            return iterations;
+
+        if (*elapsed == 0)
+            next = iterations * 100;
+        else
+            next = (uint64_t)((double)iterations * 1.2 * (double)sample_time / (double)*elapsed);
+        if (next < iterations * 2)
+            next = iterations * 2;
+        if (next > iterations * 100)
+            next = iterations * 100;
+        if (next > MAXIMUM_BENCHMARK_ITERATIONS)
+            next = MAXIMUM_BENCHMARK_ITERATIONS;
+        iterations = next;
+    }
+}
+
+static uint64_t time_iterations(void (*body)(CgreenBenchmark *), uint64_t iterations) {
+    CgreenBenchmark benchmark;
+
+    benchmark.iterations = iterations;
+    benchmark.elapsed = 0;
+    benchmark.timing = false;
+    resume_benchmark_timing(&benchmark);
+    (*body)(&benchmark);
+    pause_benchmark_timing(&benchmark);
+
+    return benchmark.elapsed;
+}
+
+static int compare_times(const void *left, const void *right) {
+    double left_time = *(const double *)left;
+    double right_time = *(const double *)right;
+
+    return (left_time > right_time) - (left_time < right_time);
+}
+
+static void calculate_statistics(CgreenBenchmarkStatistics *statistics, int samples) {
+    double *times = statistics->sample_times;
+    double sum = 0.0;
+    double squares = 0.0;
+    int i;
+
+    qsort(times, samples, sizeof(double), compare_times);
+
+    for (i = 0; i < samples; i++)
+        sum += times[i];
+    statistics->mean = sum / samples;
+    for (i = 0; i < samples; i++)
+        squares += (times[i] - statistics->mean) * (times[i] - statistics->mean);
+
+    statistics->samples = samples;
+    statistics->minimum = times[0];
+    if (samples % 2 == 0)
+        statistics->median = (times[samples/2 - 1] + times[samples/2]) / 2.0;
+    else
+        statistics->median = times[samples/2];
+    /* Nearest rank */
+    statistics->percentile_99 = times[(int)ceil(0.99 * samples) - 1];
+    statistics->standard_deviation = samples > 1 ? sqrt(squares / (samples - 1)) : 0.0;
+}
+
+
+/* A baseline has a line for each benchmark, with its name, the number
+   of samples and the sorted sample times. If a benchmark occurs more
+   than once the last line for it is used. */
+static void save_in_baseline(const char *name, const CgreenBenchmarkStatistics *statistics) {
+    FILE *baseline = fopen(baseline_to_save_in, "a");
+    int i;
+
+    if (baseline == NULL) {
+        die("Could not write to benchmark baseline file: %s\n", baseline_to_save_in);
+    }
+    /* Buffered so that the whole line is written at once, in case
+       benchmarks are run in parallel */
+    setvbuf(baseline, NULL, _IOFBF, 16384);
+    fprintf(baseline, "%s %d", name, statistics->samples);
+    for (i = 0; i < statistics->samples; i++)
+        fprintf(baseline, " %.3f", statistics->sample_times[i]);
+    fprintf(baseline, "\n");
+    fclose(baseline);
+}
+
+static bool read_baseline(const char *filename, const char *name, double *times, int *samples) {
+    FILE *baseline = fopen(filename, "r");
+    char line[16384];
+    size_t name_length = strlen(name);
+    bool found = false;
+
+    if (baseline == NULL) {
+        die("Could not read benchmark baseline file: %s\n", filename);
+    }
+    while (fgets(line, sizeof(line), baseline) != NULL) {
+        char *position, *next;
+        int count, i;
+
+        if (strncmp(line, name, name_length) != 0 || line[name_length] != ' ')
+            continue;
+        count = (int)strtol(&line[name_length], &position, 10);
+        if (count <= 0 || count > CGREEN_BENCHMARK_SAMPLES)
+            continue;
+        for (i = 0; i < count; i++) {
+            times[i] = strtod(position, &next);
+            if (next == position)
+                break;
+            position = next;
+        }
+        if (i == count) {
+            *samples = count;
+            found = true;
+        }
+    }
+    fclose(baseline);
+    return found;
+}
+
+typedef struct {
+    double time;
+    bool current;
+} RankedTime;
+
+static int compare_ranked_times(const void *left, const void *right) {
+    double left_time = ((const RankedTime *)left)->time;
+    double right_time = ((const RankedTime *)right)->time;
+
+    return (left_time > right_time) - (left_time < right_time);
+}
+
+/* The probability that the current times would be as large as they
+   are compared to the baseline if they were from the same
+   distribution, by the one-sided Mann-Whitney U test using the normal
+   approximation with correction for ties */
+static double probability_of_no_regression(const double *current, int current_count,
+                                           const double *baseline, int baseline_count) {
+    RankedTime ranked[2 * CGREEN_BENCHMARK_SAMPLES];
+    int count = current_count + baseline_count;
+    double current_rank_sum = 0.0;
+    double ties = 0.0;
+    double u, mean, variance, z;
+    int i, j;
+
+    for (i = 0; i < current_count; i++) {
+        ranked[i].time = current[i];
+        ranked[i].current = true;
+    }
+    for (i = 0; i < baseline_count; i++) {
+        ranked[current_count + i].time = baseline[i];
+        ranked[current_count + i].current = false;
+    }
+    qsort(ranked, count, sizeof(RankedTime), compare_ranked_times);
+
+    /* Tied times all get the average of their ranks */
+    for (i = 0; i < count; i = j) {
+        double rank, tied;
+        int k;
+
+        for (j = i + 1; j < count && ranked[j].time == ranked[i].time; j++)
+            ;
+        rank = (i + 1 + j) / 2.0;
+        for (k = i; k < j; k++)
+            if (ranked[k].current)
+                current_rank_sum += rank;
+        tied = j - i;
+        ties += tied * tied * tied - tied;
+    }
+
+    u = current_rank_sum - current_count * (current_count + 1) / 2.0;
+    mean = current_count * baseline_count / 2.0;
+    variance = current_count * baseline_count / 12.0
+        * ((count + 1) - ties / ((double)count * (count - 1)));
+    if (variance <= 0.0)
+        return u > mean ? 0.0 : 1.0;
+    z = (u - mean - 0.5) / sqrt(variance);
+
+    return 0.5 * erfc(z / sqrt(2.0));
+}
+
+static double median_of(const double *sorted_times, int count) {
+    if (count % 2 == 0)
+        return (sorted_times[count/2 - 1] + sorted_times[count/2]) / 2.0;
+    return sorted_times[count/2];
+}
+
+static void set_baseline_from_environment(void) {
+    const char *filename = getenv(CGREEN_BENCHMARK_BASELINE_ENVIRONMENT_VARIABLE);
+    const char *threshold_string = getenv(CGREEN_BENCHMARK_THRESHOLD_ENVIRONMENT_VARIABLE);
+    double threshold = DEFAULT_REGRESSION_THRESHOLD;
+
+    if (threshold_string != NULL) {
+        char *end;
+        threshold = strtod(threshold_string, &end);
+        if (end == threshold_string || *end != '\0' || threshold < 0.0) {
+            die("invalid value for %s environment variable: %s\n", CGREEN_BENCHMARK_THRESHOLD_ENVIRONMENT_VARIABLE,
+                threshold_string);
+        }
+    }
+    if (filename != NULL)
+        compare_benchmarks_with_baseline(filename, threshold);
+}
+
+/* A benchmark that is not in the baseline is not compared, so that
+   new benchmarks can be added */
+static void compare_with_baseline(TestReporter *reporter, const char *name, const char *filename, int line,
+                                  const CgreenBenchmarkStatistics *statistics) {
+    double baseline_times[CGREEN_BENCHMARK_SAMPLES];
+    double baseline_median, probability;
+    int baseline_samples;
+    bool regressed;
+
+    if (baseline_to_compare_with == NULL)
+        set_baseline_from_environment();
+    if (baseline_to_compare_with == NULL)
+        return;
+    if (!read_baseline(baseline_to_compare_with, name, baseline_times, &baseline_samples))
+        return;
+
+    baseline_median = median_of(baseline_times, baseline_samples);
+    probability = probability_of_no_regression(statistics->sample_times, statistics->samples,
+                                               baseline_times, baseline_samples);
+    regressed = probability < REGRESSION_SIGNIFICANCE
+        && statistics->median > baseline_median * (1.0 + regression_threshold / 100.0);
+
+    (*reporter->assert_true)(reporter, filename, line, !regressed,
+                             "Expected benchmark [%s] to be no more than %.1f%% slower than its baseline\n"
+                             "\t\tactual median: [%.1fns]\n"
+                             "\t\tbaseline median: [%.1fns]\n"
+                             "\t\tprobability of no regression: [%.4f]",
+                             name, regression_threshold,
+                             statistics->median, baseline_median, probability);
+}
+
+/* vim: set ts=4 sw=4 et cindent: */
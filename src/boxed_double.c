@@ -1,6 +1,29 @@
 #include <cgreen/boxed_double.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+
+#if INTPTR_MAX >= INT64_MAX
+
+/* A double fits in an intptr_t, so its bits are the box and nothing
+   has to be allocated for it, or freed when it is unboxed */
+intptr_t box_double(double value) {
+    intptr_t box;
+    memcpy(&box, &value, sizeof(value));
+    return box;
+}
+
+double unbox_double(intptr_t box) {
+    return as_double(box);
+}
+
+double as_double(intptr_t box) {
+    double value;
+    memcpy(&value, &box, sizeof(value));
+    return value;
+}
+
+#else
 
 /* NOTE: while returning BoxedDouble* here seems logical, it forces casts all over the place */
 intptr_t box_double(double value) {
@@ -18,3 +41,5 @@ double unbox_double(intptr_t box) {
 double as_double(intptr_t box) {
     return ((BoxedDouble *)box)->value;
 }
+
+#endif
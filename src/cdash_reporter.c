@@ -18,6 +18,7 @@
 
 #include <cgreen/cdash_reporter.h>
 #include "cdash_reporter_internal.h"
+#include "cgreen/internal/cgreen_time.h"
 
 
 typedef time_t Timer(char *strtime);
@@ -30,17 +31,16 @@ typedef struct {
     time_t begin;
     time_t startdatetime;
     time_t enddatetime;
-    time_t teststarted;
-    time_t testfinished;
+    uint64_t teststarted;
 } CDashMemo;
 
 static void cdash_destroy_reporter(TestReporter *reporter);
 static void cdash_reporter_start_suite(TestReporter *reporter, const char *name, const int number_of_tests);
 static void cdash_reporter_start_test(TestReporter *reporter, const char *name);
 
-static void cdash_show_fail(TestReporter *reporter, const char *file, int line, const char *message, va_list arguments);
-static void cdash_show_pass(TestReporter *reporter, const char *file, int line, const char *message, va_list arguments);
-static void cdash_show_incomplete(TestReporter *reporter, const char *file, int line, const char *message, va_list arguments);
+static void cdash_report_fail(TestReporter *reporter, CgreenEvent *event);
+static void cdash_report_pass(TestReporter *reporter, CgreenEvent *event);
+static void cdash_report_incomplete(TestReporter *reporter, CgreenEvent *event);
 
 static void cdash_finish_test(TestReporter *reporter, const char *filename, int line,
                                              const char *message);
@@ -49,6 +49,7 @@ static void cdash_finish_suite(TestReporter *reporter, const char *filename, int
 static time_t cdash_build_stamp(char *sbuildstamp, size_t sb);
 static time_t cdash_current_time(char *strtime);
 static double cdash_elapsed_time(time_t t1, time_t t2);
+static double cdash_test_execution_time(CDashMemo *memo);
 
 
 void set_cdash_reporter_printer(TestReporter *reporter, CDashPrinter *new_printer) {
@@ -154,12 +155,14 @@ TestReporter *create_cdash_reporter(CDashInfo *info) {
     reporter->destroy = &cdash_destroy_reporter;
     reporter->start_suite = &cdash_reporter_start_suite;
     reporter->start_test = &cdash_reporter_start_test;
-    reporter->show_fail = &cdash_show_fail;
-    reporter->show_pass = &cdash_show_pass;
-    reporter->show_incomplete = &cdash_show_incomplete;
+    reporter->report_fail = &cdash_report_fail;
+    reporter->report_pass = &cdash_report_pass;
+    reporter->report_incomplete = &cdash_report_incomplete;
     reporter->finish_test = &cdash_finish_test;
     reporter->finish_suite = &cdash_finish_suite;
     reporter->memo = memo;
+    /* Every pass is a test result of its own */
+    reporter->summarize_passes = 0;
 
     return reporter;
 }
@@ -194,7 +197,7 @@ static void cdash_reporter_start_suite(TestReporter *reporter, const char *name,
 static void cdash_reporter_start_test(TestReporter *reporter, const char *name) {
     CDashMemo *memo = (CDashMemo *)reporter->memo;
 
-    memo->teststarted = cdash_current_time(NULL);
+    memo->teststarted = cgreen_time_get_current_nanoseconds();
     reporter_start_test(reporter, name);
 }
 
@@ -209,22 +212,58 @@ static void print_test_header(CDashMemo *memo, const char* status, const char *n
                    status, name, file, file, file, line);
 }
 
-static void print_results_header(CDashMemo *memo, const char *name, float exectime) {
+static void print_numeric_measurement(CDashMemo *memo, const char *name, double value) {
+    memo->printer(memo->stream,
+                  "      <NamedMeasurement type=\"numeric/double\" name=\"%s\">\n"
+                  "       <Value>%f</Value>\n"
+                  "      </NamedMeasurement>\n",
+                  name, value);
+}
+
+/* Only known when the test was run in a process of its own */
+static void print_resource_usage(CDashMemo *memo, const CgreenResourceUsage *usage) {
+    if (!usage->measured)
+        return;
+    print_numeric_measurement(memo, "User Time", (double)usage->user_time/(double)CGREEN_NANOSECONDS_PER_SECOND);
+    print_numeric_measurement(memo, "System Time", (double)usage->system_time/(double)CGREEN_NANOSECONDS_PER_SECOND);
+    print_numeric_measurement(memo, "Max Resident Set Size", (double)usage->max_resident_set_size);
+    print_numeric_measurement(memo, "Major Page Faults", (double)usage->major_page_faults);
+    print_numeric_measurement(memo, "Minor Page Faults", (double)usage->minor_page_faults);
+    print_numeric_measurement(memo, "Voluntary Context Switches", (double)usage->voluntary_context_switches);
+    print_numeric_measurement(memo, "Involuntary Context Switches", (double)usage->involuntary_context_switches);
+}
+
+static void print_allocation_usage(CDashMemo *memo, const CgreenAllocationUsage *usage) {
+    if (!usage->counted)
+        return;
+    print_numeric_measurement(memo, "Allocations", (double)usage->allocations);
+    print_numeric_measurement(memo, "Allocated Bytes", (double)usage->bytes);
+    print_numeric_measurement(memo, "Peak Allocated Bytes", (double)usage->peak_bytes);
+    print_numeric_measurement(memo, "Unfreed Allocations", (double)usage->unfreed_allocations);
+    print_numeric_measurement(memo, "Unfreed Bytes", (double)usage->unfreed_bytes);
+}
+
+static void print_results_header(CDashMemo *memo, const char *name, float exectime,
+                                 const CgreenResourceUsage *usage) {
     memo->printer(memo->stream,
                   "     <Results>\n"
                   "      <NamedMeasurement type=\"numeric/double\" name=\"Execution Time\">\n"
                   "       <Value>%f</Value>\n"
-                  "      </NamedMeasurement>\n"
+                  "      </NamedMeasurement>\n",
+                  exectime);
+    print_resource_usage(memo, usage);
+    print_allocation_usage(memo, &usage->allocations);
+    memo->printer(memo->stream,
                   "      <NamedMeasurement type=\"text/string\" name=\"Completion Status\">\n"
                   "       <Value>Completed</Value>\n"
                   "      </NamedMeasurement>\n"
                   "      <NamedMeasurement type=\"text/string\" name=\"Command Line\">\n"
                   "       <Value>%s</Value>\n"
                   "      </NamedMeasurement>\n",
-                  exectime, name);
+                  name);
 }
 
-static void print_measurement(CDashMemo *memo, const char* message, va_list arguments) {
+static void print_measurement(CDashMemo *memo, const char* message) {
     memo->printer(memo->stream,
                   "       <Measurement>\n"
                   "        <Value>");
@@ -232,8 +271,8 @@ static void print_measurement(CDashMemo *memo, const char* message, va_list argu
         memo->printer(memo->stream,
                       "Problem");
     } else {
-        memo->vprinter(memo->stream,
-                       message, arguments);
+        memo->printer(memo->stream,
+                      "%s", message);
     }
     memo->printer(memo->stream,
                   "</Value>\n"
@@ -246,59 +285,53 @@ static void print_tail(CDashMemo *memo) {
                   "    </Test>\n");
 }
 
-static void cdash_show_fail(TestReporter *reporter, const char *file, int line, const char *message, va_list arguments) {
+static void cdash_report_fail(TestReporter *reporter, CgreenEvent *event) {
     const char *name;
     float exectime;
     CDashMemo *memo;
 
     memo = (CDashMemo *)reporter->memo;
 
-    memo->testfinished = cdash_current_time(NULL);
-
-    exectime = (float)cdash_elapsed_time(memo->teststarted, memo->testfinished);
+    exectime = (float)cdash_test_execution_time(memo);
 
     name = get_current_from_breadcrumb((CgreenBreadcrumb *)reporter->breadcrumb);
 
-    print_test_header(memo, "failed", name, file, line);
-    print_results_header(memo, name, exectime);
-    print_measurement(memo, message, arguments);
+    print_test_header(memo, "failed", name, event->file, event->line);
+    print_results_header(memo, name, exectime, &reporter->resource_usage);
+    print_measurement(memo, cgreen_event_message(event));
     print_tail(memo);
 }
 
-static void cdash_show_pass(TestReporter *reporter, const char *file, int line, const char *message, va_list arguments) {
+static void cdash_report_pass(TestReporter *reporter, CgreenEvent *event) {
     double exectime;
     CDashMemo *memo;
     const char *name = get_current_from_breadcrumb((CgreenBreadcrumb *)reporter->breadcrumb);
-    (void)message;
     memo = (CDashMemo *)reporter->memo;
 
-    memo->testfinished = cdash_current_time(NULL);
-    exectime = cdash_elapsed_time(memo->teststarted, memo->testfinished);
+    exectime = cdash_test_execution_time(memo);
 
-    print_test_header(memo, "passed", name, file, line);
-    print_results_header(memo, name, exectime);
-    print_measurement(memo, "", arguments);
+    print_test_header(memo, "passed", name, event->file, event->line);
+    print_results_header(memo, name, exectime, &reporter->resource_usage);
+    print_measurement(memo, "");
     print_tail(memo);
 }
 
 
 
-static void cdash_show_incomplete(TestReporter *reporter, const char *file, int line, const char *message, va_list arguments) {
+static void cdash_report_incomplete(TestReporter *reporter, CgreenEvent *event) {
     const char *name;
     float exectime;
     CDashMemo *memo;
 
     memo = (CDashMemo *)reporter->memo;
 
-    memo->testfinished = cdash_current_time(NULL);
-
-    exectime = (float)cdash_elapsed_time(memo->teststarted, memo->testfinished);
+    exectime = (float)cdash_test_execution_time(memo);
 
     name = get_current_from_breadcrumb((CgreenBreadcrumb *)reporter->breadcrumb);
 
-    print_test_header(memo, "incomplete", name, file, line);
-    print_results_header(memo, name, exectime);
-    print_measurement(memo, message, arguments);
+    print_test_header(memo, "incomplete", name, event->file, event->line);
+    print_results_header(memo, name, exectime, &reporter->resource_usage);
+    print_measurement(memo, cgreen_event_message(event));
     print_tail(memo);
 }
 
@@ -357,3 +390,9 @@ static double cdash_elapsed_time(time_t t1, time_t t2) {
     diff = difftime(t2, t1);
     return (diff == 0 ? 0 : (diff / 60));
 }
+/* In seconds, as CDash expects, with the resolution of the monotonic clock */
+static double cdash_test_execution_time(CDashMemo *memo) {
+    uint64_t duration = cgreen_time_duration_in_nanoseconds(memo->teststarted,
+                                                            cgreen_time_get_current_nanoseconds());
+    return (double)duration / (double)CGREEN_NANOSECONDS_PER_SECOND;
+}
@@ -1,11 +1,38 @@
+#include <limits.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 #include "cgreen/internal/cgreen_time.h"
+#include "cgreen/internal/runner_platform.h"
 
-uint32_t cgreen_time_duration_in_milliseconds(uint32_t start_time_in_milliseconds,
-                                              uint32_t end_time_in_milliseconds) {
-    if (end_time_in_milliseconds < start_time_in_milliseconds) {
+uint64_t cgreen_time_duration_in_nanoseconds(uint64_t start_time_in_nanoseconds,
+                                             uint64_t end_time_in_nanoseconds) {
+    if (end_time_in_nanoseconds < start_time_in_nanoseconds) {
         return 0;
     }
 
-    return end_time_in_milliseconds - start_time_in_milliseconds;
+    return end_time_in_nanoseconds - start_time_in_nanoseconds;
+}
+
+unsigned int cgreen_time_milliseconds_from_environment(const char *variable) {
+    const char *time_string = getenv(variable);
+    char *unit;
+    unsigned long milliseconds;
+
+    if (time_string == NULL) {
+        return 0;
+    }
+
+    milliseconds = strtoul(time_string, &unit, 10);
+    if (strcmp(unit, "ms") != 0) {
+        if (strcmp(unit, "") != 0 && strcmp(unit, "s") != 0) {
+            milliseconds = 0;
+        }
+        milliseconds *= 1000;
+    }
+    if (unit == time_string || milliseconds == 0 || milliseconds > UINT_MAX) {
+        die("invalid value for %s environment variable: %s\n", variable, time_string);
+    }
+
+    return (unsigned int)milliseconds;
 }
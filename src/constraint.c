@@ -4,6 +4,7 @@
 #include <cgreen/message_formatting.h>
 #include <cgreen/string_comparison.h>
 #include <cgreen/vector.h>
+#include <cgreen/internal/cgreen_lock.h>
 #include <inttypes.h>
 #include <float.h>
 #include <limits.h>
@@ -87,8 +88,10 @@ static const char *default_expected_value_message = "\t\texpected value:\t\t\t[%
 static void execute_sideeffect(Constraint *constraint, const char *function, CgreenValue actual,
                          const char *test_file, int test_line, TestReporter *reporter);
 
-Constraint *create_constraint() {
-    Constraint *constraint = (Constraint *)malloc(sizeof(Constraint));
+/* Of this thread only, since assertions can be made from threads */
+static CGREEN_THREAD_LOCAL Constraint *storage_for_next_constraint = NULL;
+
+static void initialize_constraint(Constraint *constraint) {
     /* TODO: setting this to NULL as an implicit type check :( */
     constraint->parameter_name = NULL;
     constraint->destroy = &destroy_empty_constraint;
@@ -96,19 +99,98 @@ Constraint *create_constraint() {
     constraint->expected_value_name = NULL;
     constraint->actual_value_message = default_actual_value_message;
     constraint->expected_value_message = default_expected_value_message;
+}
+
+Constraint *create_constraint() {
+    Constraint *constraint = (Constraint *)malloc(sizeof(Constraint));
+    initialize_constraint(constraint);
 
     return constraint;
 }
 
-static Constraint *create_constraint_expecting(CgreenValue expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint();
+void make_next_constraint_in(Constraint *storage) {
+    storage_for_next_constraint = storage;
+}
+
+void forget_storage_for_next_constraint(void) {
+    storage_for_next_constraint = NULL;
+}
+
+static Constraint *take_storage_for_next_constraint(void) {
+    Constraint *storage = storage_for_next_constraint;
+    storage_for_next_constraint = NULL;
+    return storage;
+}
+
+/* A constraint is made in the storage unless there is none, or another
+   constraint already was. Then the expected value, if it is a string,
+   and its name are borrowed instead of copied. */
+static Constraint *create_constraint_expecting(Constraint *storage, CgreenValue expected_value,
+                                               const char *expected_value_name) {
+    Constraint *constraint;
+
+    if (storage != NULL && storage->name == NULL) {
+        constraint = storage;
+        initialize_constraint(constraint);
+        constraint->expected_value = expected_value;
+        constraint->expected_value_name = expected_value_name;
+        return constraint;
+    }
 
-    constraint->expected_value = expected_value;
+    constraint = create_constraint();
+    if (expected_value.type == STRING) {
+        constraint->expected_value = make_cgreen_string_value(expected_value.value.string_value);
+    } else {
+        constraint->expected_value = expected_value;
+    }
     constraint->expected_value_name = string_dup(expected_value_name);
 
     return constraint;
 }
 
+/* Owning nothing, a constraint made in storage frees nothing */
+static void destroy_borrowing_constraint(Constraint *constraint) {
+    constraint->name = NULL;
+    constraint->parameter_name = NULL;
+    constraint->compare = NULL;
+    constraint->execute = NULL;
+    constraint->destroy = NULL;
+}
+
+static Constraint *borrowing_if_made_in(Constraint *storage, Constraint *constraint) {
+    if (constraint == storage)
+        constraint->destroy = &destroy_borrowing_constraint;
+    return constraint;
+}
+
+Constraint *keep_constraint(Constraint *constraint) {
+    Constraint *kept;
+
+    if (constraint->destroy != &destroy_borrowing_constraint) {
+        return constraint;
+    }
+
+    kept = (Constraint *)malloc(sizeof(Constraint));
+    *kept = *constraint;
+    if (kept->type == STRING_COMPARER) {
+        kept->expected_value = make_cgreen_string_value(constraint->expected_value.value.string_value);
+        kept->destroy = &destroy_string_constraint;
+    } else if (kept->type == DOUBLE_COMPARER) {
+        kept->destroy = &destroy_double_constraint;
+    } else {
+        kept->destroy = &destroy_empty_constraint;
+    }
+    kept->expected_value_name = string_dup(constraint->expected_value_name);
+
+    return kept;
+}
+
+static CgreenValue make_string_value_to_copy(const char *string) {
+    CgreenValue value = {STRING, {0}};
+    value.value.string_value = string;
+    return value;
+}
+
 void destroy_empty_constraint(Constraint *constraint) {
     constraint->name = NULL;
     constraint->parameter_name = NULL;
@@ -152,7 +234,11 @@ bool constraint_is_not_for_parameter(const Constraint *constraint, const char *p
 }
 
 Constraint *create_equal_to_value_constraint(intptr_t expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_integer_value(expected_value), expected_value_name);
+    return create_equal_to_value_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_equal_to_value_constraint_in(Constraint *storage, intptr_t expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_cgreen_integer_value(expected_value), expected_value_name);
     constraint->type = VALUE_COMPARER;
 
     constraint->compare = &compare_want_value;
@@ -160,11 +246,15 @@ Constraint *create_equal_to_value_constraint(intptr_t expected_value, const char
     constraint->name = "equal";
     constraint->size_of_expected_value = sizeof(intptr_t);
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_equal_to_hexvalue_constraint(intptr_t expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_integer_value(expected_value), expected_value_name);
+    return create_equal_to_hexvalue_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_equal_to_hexvalue_constraint_in(Constraint *storage, intptr_t expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_cgreen_integer_value(expected_value), expected_value_name);
     constraint->type = VALUE_COMPARER;
 
     constraint->compare = &compare_want_value;
@@ -174,11 +264,15 @@ Constraint *create_equal_to_hexvalue_constraint(intptr_t expected_value, const c
     constraint->actual_value_message = "\n\t\tactual value:\t\t\t[0x%x]";
     constraint->expected_value_message = "\t\texpected value:\t\t\t[0x%x]";
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_not_equal_to_value_constraint(intptr_t expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_integer_value(expected_value), expected_value_name);
+    return create_not_equal_to_value_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_not_equal_to_value_constraint_in(Constraint *storage, intptr_t expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_cgreen_integer_value(expected_value), expected_value_name);
     constraint->type = VALUE_COMPARER;
 
     constraint->compare = &compare_do_not_want_value;
@@ -186,11 +280,15 @@ Constraint *create_not_equal_to_value_constraint(intptr_t expected_value, const
     constraint->name = "not equal";
     constraint->size_of_expected_value = sizeof(intptr_t);
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_less_than_value_constraint(intptr_t expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_integer_value(expected_value), expected_value_name);
+    return create_less_than_value_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_less_than_value_constraint_in(Constraint *storage, intptr_t expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_cgreen_integer_value(expected_value), expected_value_name);
     constraint->type = VALUE_COMPARER;
 
     constraint->compare = &compare_want_lesser_value;
@@ -199,11 +297,15 @@ Constraint *create_less_than_value_constraint(intptr_t expected_value, const cha
     constraint->expected_value_message = "\t\texpected to be less than:\t[%" PRIdPTR "]";
     constraint->size_of_expected_value = sizeof(intptr_t);
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_greater_than_value_constraint(intptr_t expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_integer_value(expected_value), expected_value_name);
+    return create_greater_than_value_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_greater_than_value_constraint_in(Constraint *storage, intptr_t expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_cgreen_integer_value(expected_value), expected_value_name);
     constraint->type = VALUE_COMPARER;
 
     constraint->compare = &compare_want_greater_value;
@@ -212,11 +314,15 @@ Constraint *create_greater_than_value_constraint(intptr_t expected_value, const
     constraint->expected_value_message = "\t\texpected to be greater than:\t[%" PRIdPTR "]";
     constraint->size_of_expected_value = sizeof(intptr_t);
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_equal_to_contents_constraint(void *pointer_to_compare, size_t size_to_compare, const char *compared_pointer_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_pointer_value(pointer_to_compare), compared_pointer_name);
+    return create_equal_to_contents_constraint_in(take_storage_for_next_constraint(), pointer_to_compare, size_to_compare, compared_pointer_name);
+}
+
+Constraint *create_equal_to_contents_constraint_in(Constraint *storage, void *pointer_to_compare, size_t size_to_compare, const char *compared_pointer_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_cgreen_pointer_value(pointer_to_compare), compared_pointer_name);
     constraint->type = CONTENT_COMPARER;
 
     constraint->compare = &compare_want_contents;
@@ -224,11 +330,15 @@ Constraint *create_equal_to_contents_constraint(void *pointer_to_compare, size_t
     constraint->name = "equal contents of";
     constraint->size_of_expected_value = size_to_compare;
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_not_equal_to_contents_constraint(void *pointer_to_compare, size_t size_to_compare, const char *compared_pointer_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_pointer_value(pointer_to_compare), compared_pointer_name);
+    return create_not_equal_to_contents_constraint_in(take_storage_for_next_constraint(), pointer_to_compare, size_to_compare, compared_pointer_name);
+}
+
+Constraint *create_not_equal_to_contents_constraint_in(Constraint *storage, void *pointer_to_compare, size_t size_to_compare, const char *compared_pointer_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_cgreen_pointer_value(pointer_to_compare), compared_pointer_name);
     constraint->type = CONTENT_COMPARER;
 
     constraint->compare = &compare_do_not_want_contents;
@@ -236,11 +346,15 @@ Constraint *create_not_equal_to_contents_constraint(void *pointer_to_compare, si
     constraint->name = "not equal contents of";
     constraint->size_of_expected_value = size_to_compare;
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_equal_to_string_constraint(const char* expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_string_value(expected_value), expected_value_name);
+    return create_equal_to_string_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_equal_to_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_string_value_to_copy(expected_value), expected_value_name);
     constraint->type = STRING_COMPARER;
 
     constraint->compare = &compare_want_string;
@@ -249,11 +363,15 @@ Constraint *create_equal_to_string_constraint(const char* expected_value, const
     constraint->destroy = &destroy_string_constraint;
     constraint->expected_value_message = "\t\texpected to equal:\t\t[\"%s\"]";
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_not_equal_to_string_constraint(const char* expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_string_value(expected_value), expected_value_name);
+    return create_not_equal_to_string_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_not_equal_to_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_string_value_to_copy(expected_value), expected_value_name);
     constraint->type = STRING_COMPARER;
 
     constraint->compare = &compare_do_not_want_string;
@@ -262,11 +380,15 @@ Constraint *create_not_equal_to_string_constraint(const char* expected_value, co
     constraint->destroy = &destroy_string_constraint;
     constraint->expected_value_message = "\t\texpected to not equal:\t[\"%s\"]";
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_contains_string_constraint(const char* expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_string_value(expected_value), expected_value_name);
+    return create_contains_string_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_contains_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_string_value_to_copy(expected_value), expected_value_name);
     constraint->type = STRING_COMPARER;
 
     constraint->compare = &compare_want_substring;
@@ -275,11 +397,15 @@ Constraint *create_contains_string_constraint(const char* expected_value, const
     constraint->destroy = &destroy_string_constraint;
     constraint->expected_value_message = "\t\texpected to contain:\t\t[\"%s\"]";
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_does_not_contain_string_constraint(const char* expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_string_value(expected_value), expected_value_name);
+    return create_does_not_contain_string_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_does_not_contain_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_string_value_to_copy(expected_value), expected_value_name);
     constraint->type = STRING_COMPARER;
 
     constraint->compare = &compare_do_not_want_substring;
@@ -288,11 +414,15 @@ Constraint *create_does_not_contain_string_constraint(const char* expected_value
     constraint->destroy = &destroy_string_constraint;
     constraint->expected_value_message = "\t\texpected to not contain:\t[\"%s\"]";
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_begins_with_string_constraint(const char* expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_string_value(expected_value), expected_value_name);
+    return create_begins_with_string_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_begins_with_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_string_value_to_copy(expected_value), expected_value_name);
     constraint->type = STRING_COMPARER;
 
     constraint->compare = &compare_want_beginning_of_string;
@@ -301,11 +431,15 @@ Constraint *create_begins_with_string_constraint(const char* expected_value, con
     constraint->destroy = &destroy_string_constraint;
     constraint->expected_value_message = "\t\texpected to begin with:\t\t[\"%s\"]";
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_does_not_begin_with_string_constraint(const char* expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_string_value(expected_value), expected_value_name);
+    return create_does_not_begin_with_string_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_does_not_begin_with_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_string_value_to_copy(expected_value), expected_value_name);
     constraint->type = STRING_COMPARER;
 
     constraint->compare = &compare_do_not_want_beginning_of_string;
@@ -314,11 +448,15 @@ Constraint *create_does_not_begin_with_string_constraint(const char* expected_va
     constraint->destroy = &destroy_string_constraint;
     constraint->expected_value_message = "\t\texpected to not begin with:\t[\"%s\"]";
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_ends_with_string_constraint(const char* expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_string_value(expected_value), expected_value_name);
+    return create_ends_with_string_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_ends_with_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_string_value_to_copy(expected_value), expected_value_name);
     constraint->type = STRING_COMPARER;
 
     constraint->compare = &compare_want_end_of_string;
@@ -327,11 +465,15 @@ Constraint *create_ends_with_string_constraint(const char* expected_value, const
     constraint->destroy = &destroy_string_constraint;
     constraint->expected_value_message = "\t\texpected to end with:\t\t[\"%s\"]";
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_does_not_end_with_string_constraint(const char* expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_string_value(expected_value), expected_value_name);
+    return create_does_not_end_with_string_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_does_not_end_with_string_constraint_in(Constraint *storage, const char* expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_string_value_to_copy(expected_value), expected_value_name);
     constraint->type = STRING_COMPARER;
 
     constraint->compare = &compare_do_not_want_end_of_string;
@@ -340,11 +482,15 @@ Constraint *create_does_not_end_with_string_constraint(const char* expected_valu
     constraint->destroy = &destroy_string_constraint;
     constraint->expected_value_message = "\t\texpected to not end with:\t[\"%s\"]";
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_equal_to_double_constraint(double expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_double_value(expected_value), expected_value_name);
+    return create_equal_to_double_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_equal_to_double_constraint_in(Constraint *storage, double expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_cgreen_double_value(expected_value), expected_value_name);
     constraint->type = DOUBLE_COMPARER;
 
     constraint->compare = &compare_want_double;
@@ -352,11 +498,15 @@ Constraint *create_equal_to_double_constraint(double expected_value, const char
     constraint->name = "equal double";
     constraint->destroy = &destroy_double_constraint;
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_not_equal_to_double_constraint(double expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_double_value(expected_value), expected_value_name);
+    return create_not_equal_to_double_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_not_equal_to_double_constraint_in(Constraint *storage, double expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_cgreen_double_value(expected_value), expected_value_name);
     constraint->type = DOUBLE_COMPARER;
 
     constraint->compare = &compare_do_not_want_double;
@@ -364,11 +514,15 @@ Constraint *create_not_equal_to_double_constraint(double expected_value, const c
     constraint->name = "not equal double";
     constraint->destroy = &destroy_double_constraint;
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_less_than_double_constraint(double expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_double_value(expected_value), expected_value_name);
+    return create_less_than_double_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_less_than_double_constraint_in(Constraint *storage, double expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_cgreen_double_value(expected_value), expected_value_name);
     constraint->type = DOUBLE_COMPARER;
 
     constraint->compare = &compare_want_lesser_double;
@@ -377,11 +531,15 @@ Constraint *create_less_than_double_constraint(double expected_value, const char
     constraint->destroy = &destroy_double_constraint;
     constraint->expected_value_message = "\t\texpected to be less than:\t[%08f]";
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_greater_than_double_constraint(double expected_value, const char *expected_value_name) {
-    Constraint *constraint = create_constraint_expecting(make_cgreen_double_value(expected_value), expected_value_name);
+    return create_greater_than_double_constraint_in(take_storage_for_next_constraint(), expected_value, expected_value_name);
+}
+
+Constraint *create_greater_than_double_constraint_in(Constraint *storage, double expected_value, const char *expected_value_name) {
+    Constraint *constraint = create_constraint_expecting(storage, make_cgreen_double_value(expected_value), expected_value_name);
     constraint->type = DOUBLE_COMPARER;
 
     constraint->compare = &compare_want_greater_double;
@@ -390,7 +548,7 @@ Constraint *create_greater_than_double_constraint(double expected_value, const c
     constraint->destroy = &destroy_double_constraint;
     constraint->expected_value_message = "\t\texpected to be greater than:\t[%08f]";
 
-    return constraint;
+    return borrowing_if_made_in(storage, constraint);
 }
 
 Constraint *create_return_value_constraint(intptr_t value_to_return) {
@@ -521,10 +679,42 @@ static void execute_sideeffect(Constraint *constraint, const char *function, Cgr
 }
 
 
+/* The comparison is made before anything is formatted, and a failure
+   message is only built if it fails. A passing assertion is shown
+   with a message that is formatted only if a reporter wants it. */
+void show_comparison(TestReporter *reporter, CgreenEvent *event, Constraint *constraint,
+                     CgreenValue actual) {
+    char *message;
+
+    if ((*constraint->compare)(constraint, actual)) {
+        if (no_expected_value_in(constraint)) {
+            reporter_show_assertion(reporter, true, event, "Expected [%s] to [%s]",
+                                    event->expression, constraint->name);
+        } else {
+            reporter_show_assertion(reporter, true, event, "Expected [%s] to [%s] [%s]",
+                                    event->expression, constraint->name, constraint->expected_value_name);
+        }
+        return;
+    }
+
+    if (constraint->failure_message == &failure_message_for) {
+        reporter_show_assertion(reporter, false, event, "%s",
+                                failure_message_in_this_test_for(constraint, event->expression,
+                                                                 actual.value.integer_value));
+        return;
+    }
+
+    /* the message of a constraint of its own is used as a format */
+    message = constraint->failure_message(constraint, event->expression, actual.value.integer_value);
+    reporter_show_assertion(reporter, false, event, message);
+    free(message);
+}
+
 void test_want(Constraint *constraint, const char *function, CgreenValue actual,
                const char *test_file, int test_line, TestReporter *reporter) {
     char *message;
     char parameter_name_actual_string[255];
+    CgreenEvent event;
 
     if (parameters_are_not_valid_for(constraint, actual.value.integer_value)) {
         message = validation_failure_message_for(constraint, actual.value.integer_value);
@@ -541,17 +731,18 @@ void test_want(Constraint *constraint, const char *function, CgreenValue actual,
         return;
     }
 
-    snprintf(parameter_name_actual_string, sizeof(parameter_name_actual_string) - 1, "[%s] parameter in [%s]", constraint->parameter_name, function);
-    message = constraint->failure_message(constraint, parameter_name_actual_string, actual.value.integer_value);
-
-    (*reporter->assert_true)(
-            reporter,
-            test_file,
-            test_line,
-            (*constraint->compare)(constraint, actual),
-            message);
+    memset(&event, 0, sizeof(event));
+    event.file = test_file;
+    event.line = test_line;
+    event.constraint = constraint->name;
+    event.expected = constraint->expected_value_name;
 
-    free(message);
+    /* mocks check their parameters on every call, so the expression is
+       made on the stack and the message is only formatted if the
+       reporter wants it */
+    snprintf(parameter_name_actual_string, sizeof(parameter_name_actual_string) - 1, "[%s] parameter in [%s]", constraint->parameter_name, function);
+    event.expression = parameter_name_actual_string;
+    show_comparison(reporter, &event, constraint, actual);
 }
 
 static bool compare_want_string(Constraint *constraint, CgreenValue actual) {
@@ -719,24 +910,19 @@ bool is_parameter(const Constraint *constraint) {
     return is_comparing(constraint) || is_content_setting(constraint);
 }
 
-bool constraint_is_for_parameter_in(const Constraint *constraint, const char *names) {
+bool constraint_is_for_parameter_in(const Constraint *constraint, CgreenVector *parameter_names) {
     int i;
-    bool found = false;
 
-    CgreenVector *parameter_names = create_vector_of_names(names);
     if (!is_parameter(constraint)) return false;
 
     for (i = 0; i < cgreen_vector_size(parameter_names); i++) {
         const char *mock_parameter_name = (const char *)cgreen_vector_get(parameter_names, i);
 
-        if (constraint_is_for_parameter(constraint, mock_parameter_name)) {
-            found = true;
-            break;
-        }
+        if (constraint_is_for_parameter(constraint, mock_parameter_name))
+            return true;
     }
 
-    destroy_cgreen_vector(parameter_names);
-    return found;
+    return false;
 }
 
 bool doubles_are_equal(double tried, double expected) {
@@ -1,6 +1,8 @@
 #ifndef CONSTRAINT_INTERNAL_H
 #define CONSTRAINT_INTERNAL_H
 
+#include <cgreen/vector.h>
+
 /* constraints internal functions are used from some user level tests so must be compilable in C++ */
 #ifdef __cplusplus
 namespace cgreen {
@@ -13,6 +15,7 @@ extern void destroy_string_constraint(Constraint *constraint);
 extern void destroy_double_constraint(Constraint *constraint);
 extern void destroy_constraint(Constraint *);
 extern void destroy_constraints(va_list constraints);
+extern void forget_storage_for_next_constraint(void);
 
 
 extern bool no_expected_value_in(const Constraint *constraint);
@@ -27,11 +30,14 @@ extern bool is_not_comparing(const Constraint *constraint);
 extern bool is_parameter(const Constraint *);
 extern bool constraint_is_not_for_parameter(const Constraint *, const char *);
 extern bool constraint_is_for_parameter(const Constraint *, const char *);
-extern bool constraint_is_for_parameter_in(const Constraint *, const char *);
+extern bool constraint_is_for_parameter_in(const Constraint *, CgreenVector *);
 extern bool doubles_are_equal(double tried, double expected);
 extern bool double_is_lesser(double actual, double expected);
 extern bool double_is_greater(double actual, double expected);
 
+extern void show_comparison(TestReporter *reporter, CgreenEvent *event, Constraint *constraint,
+                            CgreenValue actual);
+
 
 #ifdef __cplusplus
     }
@@ -0,0 +1,277 @@
+/* The allocation functions of the cgreen_allocations library. Only
+   programs that link it, or preload it, have their allocations
+   counted, since they are all replaced by these, which count and then
+   call the real ones. */
+#define _GNU_SOURCE
+#include <cgreen/internal/cgreen_allocation_counter.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __GLIBC__
+#include <dlfcn.h>
+#include <malloc.h>
+#include <pthread.h>
+
+/* With glibc the allocation functions can be replaced by ones that
+   count, and then call the real ones. Sizes are what the blocks can
+   actually hold, so that the same size is counted when they are freed.
+   Only blocks allocated while counting are counted when freed, so they
+   are kept in a table of their own, allocated by the real functions. */
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *pointer, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+extern void *__libc_valloc(size_t size);
+extern void *__libc_pvalloc(size_t size);
+extern void __libc_free(void *pointer);
+
+/* Nothing is counted unless asked for, so the replaced allocation
+   functions only check this before calling the real ones */
+static int counting = false;
+static CgreenAllocationUsage counted;
+static pthread_mutex_t counts_lock = PTHREAD_MUTEX_INITIALIZER;
+static void **counted_blocks = NULL;
+static size_t counted_blocks_capacity = 0;
+static size_t number_of_counted_blocks = 0;
+
+static bool is_counting(void) {
+    return __atomic_load_n(&counting, __ATOMIC_ACQUIRE);
+}
+
+static void set_counting(bool on) {
+    __atomic_store_n(&counting, on, __ATOMIC_RELEASE);
+}
+
+static void lock_counts(void) {
+    pthread_mutex_lock(&counts_lock);
+}
+
+static void unlock_counts(void) {
+    pthread_mutex_unlock(&counts_lock);
+}
+
+static size_t slot_of(void *block) {
+    return (size_t)(((uintptr_t)block >> 4) * 2654435761u) & (counted_blocks_capacity - 1);
+}
+
+static void forget_counted_blocks(void) {
+    if (counted_blocks != NULL)
+        memset(counted_blocks, 0, counted_blocks_capacity * sizeof(void *));
+    number_of_counted_blocks = 0;
+}
+
+static void start_counting(void) {
+    lock_counts();
+    memset(&counted, 0, sizeof(counted));
+    forget_counted_blocks();
+    set_counting(true);
+    unlock_counts();
+}
+
+static void stop_counting(void) {
+    set_counting(false);
+}
+
+static void read_counted(CgreenAllocationUsage *usage) {
+    lock_counts();
+    *usage = counted;
+    unlock_counts();
+}
+
+static const CgreenAllocationCounter counter = {
+    &start_counting,
+    &stop_counting,
+    &is_counting,
+    &read_counted
+};
+
+/* A library that is loaded by dlopen(), like a test library run by
+   cgreen-runner, can't replace the allocation functions of the
+   program that loaded it, so its counter would never count anything.
+   It is only registered if these are the ones that are called. */
+__attribute__((constructor))
+static void register_counter(void) {
+    Dl_info called, this_library;
+    void *malloc_called = dlsym(RTLD_DEFAULT, "malloc");
+
+    if (malloc_called == NULL
+        || dladdr(malloc_called, &called) == 0
+        || dladdr((void *)&register_counter, &this_library) == 0
+        || called.dli_fbase != this_library.dli_fbase)
+        return;
+    count_allocations_with(&counter);
+}
+
+static void insert_counted_block(void *block) {
+    size_t slot = slot_of(block);
+
+    while (counted_blocks[slot] != NULL)
+        slot = (slot + 1) & (counted_blocks_capacity - 1);
+    counted_blocks[slot] = block;
+    number_of_counted_blocks++;
+}
+/* The table is kept at most half full */
+static bool make_room_for_counted_block(void) {
+    void **blocks = counted_blocks;
+    size_t capacity = counted_blocks_capacity;
+    size_t slot;
+
+    if (2 * (number_of_counted_blocks + 1) <= counted_blocks_capacity)
+        return true;
+    counted_blocks_capacity = capacity == 0 ? 1024 : 2 * capacity;
+    counted_blocks = (void **)__libc_calloc(counted_blocks_capacity, sizeof(void *));
+    if (counted_blocks == NULL) {
+        counted_blocks = blocks;
+        counted_blocks_capacity = capacity;
+        return false;
+    }
+    number_of_counted_blocks = 0;
+    for (slot = 0; slot < capacity; slot++)
+        if (blocks[slot] != NULL)
+            insert_counted_block(blocks[slot]);
+    __libc_free(blocks);
+    return true;
+}
+
+/* Removing a block moves the ones after it that would not be found
+   past the empty slot it leaves */
+static bool remove_counted_block(void *block) {
+    size_t mask = counted_blocks_capacity - 1;
+    size_t empty, slot, wanted;
+
+    if (number_of_counted_blocks == 0)
+        return false;
+    for (empty = slot_of(block); counted_blocks[empty] != block; empty = (empty + 1) & mask)
+        if (counted_blocks[empty] == NULL)
+            return false;
+    for (slot = (empty + 1) & mask; counted_blocks[slot] != NULL; slot = (slot + 1) & mask) {
+        wanted = slot_of(counted_blocks[slot]);
+        if (((slot - wanted) & mask) >= ((slot - empty) & mask)) {
+            counted_blocks[empty] = counted_blocks[slot];
+            empty = slot;
+        }
+    }
+    counted_blocks[empty] = NULL;
+    number_of_counted_blocks--;
+    return true;
+}
+
+/* Called with the counts locked */
+static void count_allocation(void *pointer) {
+    size_t size;
+
+    if (pointer == NULL || !make_room_for_counted_block())
+        return;
+    insert_counted_block(pointer);
+    size = malloc_usable_size(pointer);
+    counted.allocations++;
+    counted.bytes += size;
+    counted.unfreed_allocations++;
+    counted.unfreed_bytes += size;
+    if (counted.unfreed_bytes > 0 && (uint64_t)counted.unfreed_bytes > counted.peak_bytes)
+        counted.peak_bytes = (uint64_t)counted.unfreed_bytes;
+}
+
+/* Called with the counts locked, with the size the block had */
+static void count_free(void *pointer, size_t size) {
+    if (pointer == NULL || !remove_counted_block(pointer))
+        return;
+    counted.unfreed_allocations--;
+    counted.unfreed_bytes -= size;
+}
+
+static void *counting_allocation(void *pointer) {
+    lock_counts();
+    count_allocation(pointer);
+    unlock_counts();
+    return pointer;
+}
+
+void *malloc(size_t size) {
+    if (!is_counting())
+        return __libc_malloc(size);
+    return counting_allocation(__libc_malloc(size));
+}
+
+void *calloc(size_t count, size_t size) {
+    if (!is_counting())
+        return __libc_calloc(count, size);
+    return counting_allocation(__libc_calloc(count, size));
+}
+
+/* A block that is moved or resized is counted as freed and allocated
+   again. The counts are locked while it is, so that no other thread
+   can be given the old block and count it before it is removed. */
+void *realloc(void *pointer, size_t size) {
+    size_t old_size;
+    void *reallocated;
+
+    if (!is_counting())
+        return __libc_realloc(pointer, size);
+
+    lock_counts();
+    old_size = pointer != NULL ? malloc_usable_size(pointer) : 0;
+    reallocated = __libc_realloc(pointer, size);
+    if (reallocated != NULL || size == 0) {
+        count_free(pointer, old_size);
+        count_allocation(reallocated);
+    }
+    unlock_counts();
+    return reallocated;
+}
+
+void *reallocarray(void *pointer, size_t count, size_t size) {
+    if (size != 0 && count > SIZE_MAX / size) {
+        errno = ENOMEM;
+        return NULL;
+    }
+    return realloc(pointer, count * size);
+}
+
+void *memalign(size_t alignment, size_t size) {
+    if (!is_counting())
+        return __libc_memalign(alignment, size);
+    return counting_allocation(__libc_memalign(alignment, size));
+}
+
+void *aligned_alloc(size_t alignment, size_t size) {
+    return memalign(alignment, size);
+}
+
+int posix_memalign(void **pointer, size_t alignment, size_t size) {
+    void *allocated;
+
+    if (alignment == 0 || alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0)
+        return EINVAL;
+    allocated = memalign(alignment, size);
+    if (allocated == NULL)
+        return ENOMEM;
+    *pointer = allocated;
+    return 0;
+}
+
+void *valloc(size_t size) {
+    if (!is_counting())
+        return __libc_valloc(size);
+    return counting_allocation(__libc_valloc(size));
+}
+
+void *pvalloc(size_t size) {
+    if (!is_counting())
+        return __libc_pvalloc(size);
+    return counting_allocation(__libc_pvalloc(size));
+}
+
+void free(void *pointer) {
+    if (pointer != NULL && is_counting()) {
+        lock_counts();
+        count_free(pointer, malloc_usable_size(pointer));
+        unlock_counts();
+    }
+    __libc_free(pointer);
+}
+
+#endif
+
+/* vim: set ts=4 sw=4 et cindent: */
@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "cgreen/internal/cgreen_time.h"
 #include "cute_reporter_internal.h"
 
 #ifdef __ANDROID__
@@ -21,12 +22,9 @@ static void cute_start_suite(TestReporter *reporter,
         const char *name, const int number_of_tests);
 static void cute_start_test(TestReporter *reporter,
         const char *name);
-static void show_fail(TestReporter *reporter, const char *file, int line,
-        const char *message, va_list arguments);
-static void show_pass(TestReporter *reporter, const char *file, int line,
-        const char *message, va_list arguments);
+static void report_fail(TestReporter *reporter, CgreenEvent *event);
 static void cute_failed_to_complete(TestReporter *reporter,
-        const char *file, int line, const char *message, va_list arguments);
+        CgreenEvent *event);
 static void cute_finish_test(TestReporter *reporter,
         const char *filename, int line, const char *message);
 static void cute_finish_suite(TestReporter *reporter,
@@ -64,9 +62,8 @@ TestReporter *create_cute_reporter(void) {
 
     reporter->start_suite = &cute_start_suite;
     reporter->start_test = &cute_start_test;
-    reporter->show_fail = &show_fail;
-    reporter->show_pass = &show_pass;
-    reporter->show_incomplete = &cute_failed_to_complete;
+    reporter->report_fail = &report_fail;
+    reporter->report_incomplete = &cute_failed_to_complete;
     reporter->finish_test = &cute_finish_test;
     reporter->finish_suite = &cute_finish_suite;
     reporter->memo = memo;
@@ -118,50 +115,38 @@ static void cute_finish_suite(TestReporter *reporter, const char *filename, int
 
     memo->printer("#ending %s", name);
     if (get_breadcrumb_depth((CgreenBreadcrumb *) reporter->breadcrumb) == 0) {
-        memo->printer(": %d pass%s, %d failure%s, %d exception%s, %d ms.\n",
+        memo->printer(": %d pass%s, %d failure%s, %d exception%s, %lu ms.\n",
                       reporter->passes, reporter->passes == 1 ? "" : "es",
                       reporter->failures, reporter->failures == 1 ? "" : "s",
                       reporter->exceptions, reporter->exceptions == 1 ? "" : "s",
-                      reporter->total_duration);
+                      (unsigned long)(reporter->total_duration_ns / CGREEN_NANOSECONDS_PER_MILLISECOND));
     } else
         memo->printer("\n");
 }
 
-static void show_fail(TestReporter *reporter, const char *file, int line,
-        const char *message, va_list arguments) {
+static void report_fail(TestReporter *reporter, CgreenEvent *event) {
     CuteMemo *memo = (CuteMemo *) reporter->memo;
     if (!memo->previous_error) {
+        const char *message = cgreen_event_message(event);
         memo->printer("#failure %s",
                       get_current_from_breadcrumb((CgreenBreadcrumb *) reporter->breadcrumb));
-        memo->printer(" %s:%d ", file, line);
+        memo->printer(" %s:%d ", event->file, event->line);
         if (message == NULL) {
             memo->printer("<FATAL: NULL for failure message>");
         } else {
-            memo->vprinter(message, arguments);
+            memo->printer("%s", message);
         }
         memo->printer("\n");
         memo->previous_error = 1;
     }
 }
 
-static void show_pass(TestReporter *reporter, const char *file, int line,
-        const char *message, va_list arguments) {
-    (void) reporter;
-    (void) file;
-    (void) line;
-    (void) message;
-    (void) arguments;
-}
-
 static void cute_failed_to_complete(TestReporter *reporter,
-        const char *file, int line, const char *message, va_list arguments) {
+        CgreenEvent *event) {
     CuteMemo *memo = (CuteMemo *)reporter->memo;
 
     /* TODO: add additional message to output */
-    (void)file;
-    (void)line;
-    (void)message;
-    (void)arguments;
+    (void)event;
 
     memo->printer("#error %s failed to complete\n",
                   get_current_from_breadcrumb((CgreenBreadcrumb *)reporter->breadcrumb));
@@ -0,0 +1,253 @@
+#include <cgreen/journal.h>
+#include <cgreen/internal/cgreen_journal.h>
+#include <cgreen/internal/cgreen_time.h>
+#include <cgreen/internal/runner_platform.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef __ANDROID__
+#include "cgreen/internal/android_headers/androidcompat.h"
+#endif // #ifdef __ANDROID__
+
+#ifdef _MSC_VER
+#include <wincompat.h>
+#pragma warning(disable:4996)
+#endif
+
+static const char* CGREEN_JOURNAL_ENVIRONMENT_VARIABLE = "CGREEN_JOURNAL";
+
+/* Room for this many records is made in the file, but only those
+   that are written take up room on disk */
+#define JOURNAL_CAPACITY 65536
+
+static CgreenJournalHeader *journal = NULL;
+
+/* The test being run by this process, and the file of its latest
+   assertion, which is only copied when it changes */
+static CgreenJournalRecord *current_test = NULL;
+static const char *file_of_latest_assertion = NULL;
+
+static CgreenJournalRecord *new_record(void);
+static CgreenJournalRecord *running_test_named(const char *name);
+static void copy_string(char *destination, size_t size, const char *source);
+
+
+void keep_journal_in(const char *filename) {
+    size_t size = (size_t)(JOURNAL_CAPACITY + 1) * CGREEN_JOURNAL_RECORD_SIZE;
+
+    journal = cgreen_journal_map(filename, size);
+    if (journal == NULL) {
+        die("Could not create journal file: %s\n", filename);
+    }
+    memcpy(journal->magic, CGREEN_JOURNAL_MAGIC, sizeof(CGREEN_JOURNAL_MAGIC));
+    journal->version = CGREEN_JOURNAL_VERSION;
+    journal->record_size = CGREEN_JOURNAL_RECORD_SIZE;
+    journal->capacity = JOURNAL_CAPACITY;
+    journal->tail = 0;
+    journal->started = cgreen_time_get_current_nanoseconds();
+}
+
+void start_journal_if_requested(void) {
+    const char *filename;
+
+    if (journal != NULL)
+        return;
+    filename = getenv(CGREEN_JOURNAL_ENVIRONMENT_VARIABLE);
+    if (filename != NULL)
+        keep_journal_in(filename);
+}
+
+void journal_test_started(const char *name, const char *file, int line) {
+    if (journal == NULL)
+        return;
+
+    current_test = new_record();
+    file_of_latest_assertion = NULL;
+    if (current_test == NULL)
+        return;
+    copy_string(current_test->name, sizeof(current_test->name), name);
+    copy_string(current_test->file, sizeof(current_test->file), file);
+    current_test->line = line;
+    cgreen_journal_publish(current_test, CGREEN_JOURNAL_TEST);
+}
+
+/* The record of the test is kept up to date with every assertion, so
+   that it tells how far the test got if it never finishes */
+void journal_assertion(int result, CgreenEvent *event) {
+    CgreenJournalRecord *failure;
+
+    if (journal == NULL)
+        return;
+
+    if (current_test != NULL) {
+        if (event->file != file_of_latest_assertion) {
+            copy_string(current_test->last_file, sizeof(current_test->last_file), event->file);
+            file_of_latest_assertion = event->file;
+        }
+        current_test->last_line = event->line;
+        if (result)
+            current_test->passes++;
+    }
+
+    if (result)
+        return;
+    failure = new_record();
+    if (failure == NULL)
+        return;
+    if (current_test != NULL)
+        copy_string(failure->name, sizeof(failure->name), current_test->name);
+    copy_string(failure->file, sizeof(failure->file), event->file);
+    failure->line = event->line;
+    copy_string(failure->message, sizeof(failure->message), cgreen_event_message(event));
+    cgreen_journal_publish(failure, CGREEN_JOURNAL_FAILURE);
+}
+
+void journal_test_finished(uint64_t duration) {
+    if (current_test == NULL)
+        return;
+    current_test->duration = duration;
+    current_test->outcome = CGREEN_JOURNAL_COMPLETED;
+    current_test = NULL;
+}
+
+void journal_test_skipped(const char *name, const char *file, int line) {
+    CgreenJournalRecord *skipped;
+
+    if (journal == NULL || (skipped = new_record()) == NULL)
+        return;
+    copy_string(skipped->name, sizeof(skipped->name), name);
+    copy_string(skipped->file, sizeof(skipped->file), file);
+    skipped->line = line;
+    cgreen_journal_publish(skipped, CGREEN_JOURNAL_SKIPPED);
+}
+
+/* Written by the parent, which does not know which record the test
+   process wrote, but the latest running test of the same name is it */
+void journal_test_not_finished(const char *name, const char *file, int line, const char *message) {
+    CgreenJournalRecord *test;
+    CgreenJournalRecord *incomplete;
+
+    if (journal == NULL)
+        return;
+
+    test = running_test_named(name);
+    if (test != NULL)
+        test->outcome = CGREEN_JOURNAL_NOT_COMPLETED;
+    incomplete = new_record();
+    if (incomplete == NULL)
+        return;
+    copy_string(incomplete->name, sizeof(incomplete->name), name);
+    copy_string(incomplete->file, sizeof(incomplete->file), file);
+    incomplete->line = line;
+    copy_string(incomplete->message, sizeof(incomplete->message), message);
+    if (test != NULL) {
+        memcpy(incomplete->last_file, test->last_file, sizeof(incomplete->last_file));
+        incomplete->last_line = test->last_line;
+        incomplete->passes = test->passes;
+    }
+    cgreen_journal_publish(incomplete, CGREEN_JOURNAL_INCOMPLETE);
+}
+
+static CgreenJournalRecord *new_record(void) {
+    CgreenJournalRecord *record = cgreen_journal_reserve(journal);
+
+    if (record == NULL)
+        return NULL;
+    record->pid = (int32_t)getpid();
+    record->time = cgreen_time_get_current_nanoseconds() - journal->started;
+    return record;
+}
+
+static CgreenJournalRecord *running_test_named(const char *name) {
+    uint64_t count = journal->tail < journal->capacity ? journal->tail : journal->capacity;
+
+    while (count > 0) {
+        CgreenJournalRecord *record = (CgreenJournalRecord *)((char *)journal
+                                                              + count * journal->record_size);
+        if (record->type == CGREEN_JOURNAL_TEST && record->outcome == CGREEN_JOURNAL_RUNNING
+            && strncmp(record->name, name, sizeof(record->name) - 1) == 0)
+            return record;
+        count--;
+    }
+    return NULL;
+}
+
+static void copy_string(char *destination, size_t size, const char *source) {
+    if (source == NULL)
+        return;
+    strncpy(destination, source, size - 1);
+}
+
+
+static void print_last_assertion(const CgreenJournalRecord *record) {
+    if (record->last_file[0] != '\0')
+        printf(", last assertion at %s:%d", record->last_file, record->last_line);
+}
+
+static void print_record(const CgreenJournalRecord *record) {
+    printf("%12.3f ms [%d] ", record->time / 1000000.0, (int)record->pid);
+    switch (record->type) {
+    case CGREEN_JOURNAL_TEST:
+        printf("test %s (%s:%d)", record->name, record->file, record->line);
+        if (record->outcome == CGREEN_JOURNAL_COMPLETED) {
+            printf(" completed with %lu passes in %.3f ms", (unsigned long)record->passes,
+                   record->duration / 1000000.0);
+        } else {
+            printf(" %s with %lu passes", record->outcome == CGREEN_JOURNAL_RUNNING ? "did not complete" : "was stopped",
+                   (unsigned long)record->passes);
+            print_last_assertion(record);
+        }
+        break;
+    case CGREEN_JOURNAL_FAILURE:
+        printf("failure in %s at %s:%d: %s", record->name, record->file, record->line, record->message);
+        break;
+    case CGREEN_JOURNAL_SKIPPED:
+        printf("skipped %s (%s:%d)", record->name, record->file, record->line);
+        break;
+    case CGREEN_JOURNAL_INCOMPLETE:
+        printf("incomplete %s (%s:%d)", record->name, record->file, record->line);
+        if (record->message[0] != '\0')
+            printf(": %s", record->message);
+        print_last_assertion(record);
+        break;
+    default:
+        printf("unwritten record");
+        break;
+    }
+    printf("\n");
+}
+
+/* Read from the file rather than mapped, so that journals from other
+   machines and runs can be looked at anywhere */
+int print_journal(const char *filename) {
+    CgreenJournalHeader header;
+    CgreenJournalRecord record;
+    uint64_t count, i;
+    FILE *file = fopen(filename, "rb");
+
+    if (file == NULL)
+        return 0;
+    if (fread(&header, sizeof(header), 1, file) != 1
+        || memcmp(header.magic, CGREEN_JOURNAL_MAGIC, sizeof(CGREEN_JOURNAL_MAGIC)) != 0
+        || header.version != CGREEN_JOURNAL_VERSION || header.record_size != sizeof(record)) {
+        fclose(file);
+        return 0;
+    }
+
+    count = header.tail < header.capacity ? header.tail : header.capacity;
+    for (i = 1; i <= count; i++) {
+        if (fseek(file, (long)(i * header.record_size), SEEK_SET) != 0
+            || fread(&record, sizeof(record), 1, file) != 1)
+            break;
+        print_record(&record);
+    }
+    if (header.tail > header.capacity)
+        printf("%lu records were lost since the journal was full\n",
+               (unsigned long)(header.tail - header.capacity));
+    fclose(file);
+    return 1;
+}
+
+/* vim: set ts=4 sw=4 et cindent: */
@@ -18,6 +18,67 @@
 #endif
 
 #include "constraint_internal.h"
+#include "cgreen/internal/cgreen_lock.h"
+
+
+#define CONSTRAINT_AS_STRING_FORMAT "Expected [%s] to [%s]"
+#define EXPECTED_VALUE_STRING_FORMAT "[%s]"
+#define ACTUAL_VALUE_STRING_FORMAT "\n\t\tactual value:\t\t\t[\"%s\"]"
+#define AT_OFFSET_FORMAT "\n\t\tat offset:\t\t\t[%d]"
+
+
+/* Failure messages for the running test are built in blocks that are
+   kept until the next test, so that they don't have to be freed by
+   whoever shows them. The first block is reused by every test, so
+   normally nothing is allocated for messages after the first failure. */
+#define MESSAGE_BLOCK_SIZE 4096
+
+typedef struct MessageBlock_ MessageBlock;
+struct MessageBlock_ {
+    MessageBlock *next;
+    size_t size;
+    size_t used;
+};
+
+static MessageBlock *message_blocks = NULL;
+
+/* Only taken when the test uses threads, see lock_failure_messages_of_threads() */
+static CgreenLock *lock_of_messages = NULL;
+static bool messages_are_locked = false;
+
+static char *allocate_message(size_t size) {
+    bool locked = messages_are_locked;
+    MessageBlock *block;
+    char *message = NULL;
+
+    if (locked)
+        cgreen_lock_take(lock_of_messages);
+    block = message_blocks;
+    if (block == NULL || block->size - block->used < size) {
+        size_t block_size = size > MESSAGE_BLOCK_SIZE ? size : MESSAGE_BLOCK_SIZE;
+        block = (MessageBlock *)malloc(sizeof(MessageBlock) + block_size);
+        if (block != NULL) {
+            block->next = message_blocks;
+            block->size = block_size;
+            block->used = 0;
+            message_blocks = block;
+        }
+    }
+    if (block != NULL) {
+        message = (char *)(block + 1) + block->used;
+        block->used += size;
+    }
+    if (locked)
+        cgreen_lock_release(lock_of_messages);
+    return message;
+}
+
+/* Made from the thread of the test, before it starts any other */
+void lock_failure_messages_of_threads(void) {
+    if (lock_of_messages == NULL)
+        lock_of_messages = cgreen_lock_create();
+    messages_are_locked = true;
+}
 
 
 // Handling of percent signs
@@ -88,14 +149,15 @@ static bool actual_value_not_necessary_for(Constraint *constraint, const char *a
 }
 
 
+/* Checked without building the message, since it is done for every
+   assertion */
 bool parameters_are_not_valid_for(Constraint *constraint, intptr_t actual) {
-    char *message = validation_failure_message_for(constraint, actual);
-
-    bool not_valid = (strlen(message) > 0);
-
-    free(message);
-
-    return not_valid;
+    if (!is_content_comparing(constraint)) {
+        return false;
+    }
+    return (long signed)constraint->size_of_expected_value <= 0 ||
+        (void *)actual == NULL ||
+        constraint->expected_value.value.pointer_value == NULL;
 }
 
 char *validation_failure_message_for(Constraint *constraint, intptr_t actual) {
@@ -170,19 +232,11 @@ static bool is_not_equal_to_string_constraint(Constraint *constraint) {
 }
 
 
-char *failure_message_for(Constraint *constraint, const char *actual_string, intptr_t actual_value) {
-    char actual_int_value_string[32];
-    const char *constraint_as_string_format = "Expected [%s] to [%s]";
-    const char *expected_value_string_format =  "[%s]";
-    const char *actual_value_string_format = "\n\t\tactual value:\t\t\t[\"%s\"]";
-    const char *at_offset = "\n\t\tat offset:\t\t\t[%d]";
-    const char *expected_content = "\n\t\t\tactual value:\t\t[0x%02x]\n\t\t\texpected value:\t\t[0x%02x]";
-    const char *actual_value_as_string;
-    char *message;
-    size_t message_size = strlen(constraint_as_string_format) +
-            strlen(expected_value_string_format) +
-            strlen(actual_value_string_format) +
-            strlen(at_offset) +
+static size_t failure_message_size_for(Constraint *constraint, const char *actual_string, intptr_t actual_value) {
+    size_t message_size = strlen(CONSTRAINT_AS_STRING_FORMAT) +
+            strlen(EXPECTED_VALUE_STRING_FORMAT) +
+            strlen(ACTUAL_VALUE_STRING_FORMAT) +
+            strlen(AT_OFFSET_FORMAT) +
             strlen(constraint->actual_value_message) +
             strlen(constraint->expected_value_message) +
             strlen(constraint->expected_value_name) +
@@ -190,29 +244,31 @@ char *failure_message_for(Constraint *constraint, const char *actual_string, int
             strlen(actual_string) +
             512; // just in case
 
-    snprintf(actual_int_value_string, sizeof(actual_int_value_string) - 1, "%" PRIdPTR, actual_value);
-
     if (values_are_strings_in(constraint)) {
         message_size += strlen(constraint->expected_value.value.string_value);
         if (actual_value != (intptr_t)NULL) {
             message_size += strlen((char *)actual_value);
         }
     }
+    return message_size;
+}
 
-    message = (char *)malloc(message_size);
 
-    /* if the actual value expression contains '%' we want it to survive the final expansion with
-       arguments that happens in assert_true() */
-    actual_value_as_string = double_all_percent_signs_in(actual_string);
+/* The message is built as it should be shown, without doubling any
+   percent signs */
+static char *build_failure_message(char *message, size_t message_size, Constraint *constraint,
+                                   const char *actual_string, intptr_t actual_value) {
+    char actual_int_value_string[32];
+    const char *expected_content = "\n\t\t\tactual value:\t\t[0x%02x]\n\t\t\texpected value:\t\t[0x%02x]";
+
+    snprintf(actual_int_value_string, sizeof(actual_int_value_string) - 1, "%" PRIdPTR, actual_value);
 
     /* expand the constraint with the actual value in string format... */
     snprintf(message, message_size - 1,
-             constraint_as_string_format,
-             actual_value_as_string,
+             CONSTRAINT_AS_STRING_FORMAT,
+             actual_string,
              constraint->name);
 
-    free((void*)actual_value_as_string);
-
     if (no_expected_value_in(constraint)) {
         return message;
     } else
@@ -220,7 +276,7 @@ char *failure_message_for(Constraint *constraint, const char *actual_string, int
 
     /* expand the expected value string for all assertions that have one... */
     snprintf(message + strlen(message), message_size - strlen(message) - 1,
-             expected_value_string_format,
+             EXPECTED_VALUE_STRING_FORMAT,
              constraint->expected_value_name);
 
     if (actual_value_not_necessary_for(constraint, actual_string, actual_int_value_string)) {
@@ -233,7 +289,7 @@ char *failure_message_for(Constraint *constraint, const char *actual_string, int
     /* for string constraints, print out the strings encountered and not their pointer values */
     if (values_are_strings_in(constraint)) {
         snprintf(message + strlen(message), message_size - strlen(message) - 1,
-                 actual_value_string_format,
+                 ACTUAL_VALUE_STRING_FORMAT,
                  (const char *)actual_value);
         if (!is_not_equal_to_string_constraint(constraint)) {
             strcat(message, "\n");
@@ -241,14 +297,6 @@ char *failure_message_for(Constraint *constraint, const char *actual_string, int
                      constraint->expected_value_message,
                      constraint->expected_value.value.string_value);
         }
-        /* The final string may have percent characters, so, since it is
-           later used in a (v)printf, we have to double them
-        */
-        if (next_percent_sign(message) != NULL) {
-            char *message_with_doubled_percent_signs = double_all_percent_signs_in(message);
-            free(message);
-            message = message_with_doubled_percent_signs;
-        }
         return message;
     }
 
@@ -259,7 +307,7 @@ char *failure_message_for(Constraint *constraint, const char *actual_string, int
                                                         constraint->size_of_expected_value);
         if (difference_index != -1) {
             snprintf(message + strlen(message), message_size - strlen(message) - 1,
-                     at_offset,
+                     AT_OFFSET_FORMAT,
                      difference_index);
             snprintf(message + strlen(message), message_size - strlen(message) - 1,
                      expected_content,
@@ -284,3 +332,46 @@ char *failure_message_for(Constraint *constraint, const char *actual_string, int
 
     return message;
 }
+
+
+/* The message is used as a format by whoever shows it, so any percent
+   signs are doubled to survive that */
+char *failure_message_for(Constraint *constraint, const char *actual_string, intptr_t actual_value) {
+    size_t message_size = failure_message_size_for(constraint, actual_string, actual_value);
+    char *message = (char *)malloc(message_size);
+
+    if (message == NULL) {
+        return NULL;
+    }
+    build_failure_message(message, message_size, constraint, actual_string, actual_value);
+    if (next_percent_sign(message) != NULL) {
+        char *message_with_doubled_percent_signs = double_all_percent_signs_in(message);
+        free(message);
+        message = message_with_doubled_percent_signs;
+    }
+    return message;
+}
+
+
+const char *failure_message_in_this_test_for(Constraint *constraint, const char *actual_string, intptr_t actual_value) {
+    size_t message_size = failure_message_size_for(constraint, actual_string, actual_value);
+    char *message = allocate_message(message_size);
+
+    if (message == NULL) {
+        return NULL;
+    }
+    return build_failure_message(message, message_size, constraint, actual_string, actual_value);
+}
+
+
+void forget_failure_messages_of_this_test(void) {
+    messages_are_locked = false;
+    while (message_blocks != NULL && message_blocks->next != NULL) {
+        MessageBlock *block = message_blocks;
+        message_blocks = block->next;
+        free(block);
+    }
+    if (message_blocks != NULL) {
+        message_blocks->used = 0;
+    }
+}
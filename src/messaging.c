@@ -1,6 +1,10 @@
 #include <cgreen/messaging.h>
 #include <cgreen/internal/cgreen_pipe.h>
+#include <cgreen/internal/cgreen_ring.h>
 #include <sys/types.h>
+#ifndef __cplusplus
+#include <stdbool.h>
+#endif
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -22,16 +26,39 @@
 
 #define message_content_size(Type) (sizeof(Type) - sizeof(long))
 
+/* Messages are written to a ring buffer in shared memory, which only
+   costs a copy. A child that fills it wakes the parent up to drain it
+   and waits for room, and the process that reads the messages drains
+   it itself, so that a test can send any number of messages. Only when
+   that is not possible do they go through the pipe. */
+#define MESSAGE_RING_SIZE (256*1024)
+
+/* Larger payloads are written to the ring in fragments of this size,
+   which the reader puts together again, so that there is no limit to
+   the size of a message either */
+#define MESSAGE_FRAGMENT_SIZE (MESSAGE_RING_SIZE/4)
+
 typedef struct CgreenMessageQueue_ {
     int readpipe;
     int writepipe;
+    int pipes[2];
+    CgreenRing *ring;
+    int wakeup[2];              /* Written to when the ring is full */
+    bool overflowed;            /* Later messages must follow in the pipe */
     pid_t owner;
     int tag;
+    void (*drain)(void *reader); /* Reads the ring in the owner when it is full */
+    void *reader;
+    char *fragments;            /* Of the payload being put together */
+    int fragments_size;
 } CgreenMessageQueue;
 
 typedef struct CgreenMessage_ {
     long type;
     int result;
+    int payload_size;
+    int fragment_offset;        /* Of the part of the payload that follows */
+    int fragment_size;
 } CgreenMessage;
 
 static CgreenMessageQueue *queues = NULL;
@@ -91,22 +118,141 @@ int start_cgreen_messaging(int tag) {
 
     queues[queue_count - 1].readpipe = pipes[0];
     queues[queue_count - 1].writepipe = pipes[1];
+    queues[queue_count - 1].pipes[0] = pipes[0];
+    queues[queue_count - 1].pipes[1] = pipes[1];
+    queues[queue_count - 1].ring = cgreen_ring_open(MESSAGE_RING_SIZE);
+    queues[queue_count - 1].wakeup[0] = -1;
+    queues[queue_count - 1].wakeup[1] = -1;
+    if (queues[queue_count - 1].ring != NULL && cgreen_pipe_open(queues[queue_count - 1].wakeup) != 0) {
+        fprintf(stderr, "could not create pipes\n");
+        return -1;
+    }
+    queues[queue_count - 1].overflowed = false;
     queues[queue_count - 1].owner = getpid();
     queues[queue_count - 1].tag = tag;
+    queues[queue_count - 1].drain = NULL;
+    queues[queue_count - 1].reader = NULL;
+    queues[queue_count - 1].fragments = NULL;
+    queues[queue_count - 1].fragments_size = 0;
     return queue_count - 1;
 }
 
+/* The process that started the messaging has no one to wait for when
+   it fills the ring itself, so it has to read what is in it to make
+   room. Without a way to do that it overflows into the pipe. */
+void drain_cgreen_messaging_with(int messaging, void (*drain)(void *reader), void *reader) {
+    queues[messaging].drain = drain;
+    queues[messaging].reader = reader;
+}
+
+/* When messages are redirected to a file the ring is not used, since
+   it can only be shared by one writer and one reader */
+static bool uses_ring_for_writing(CgreenMessageQueue *queue) {
+    return queue->ring != NULL && queue->writepipe == queue->pipes[1] && !queue->overflowed;
+}
+
+static bool uses_ring_for_reading(CgreenMessageQueue *queue) {
+    return queue->ring != NULL && queue->readpipe == queue->pipes[0];
+}
+
+/* The reader can poll this to know when to drain the queue, or -1 if
+   it does not have to */
+int get_cgreen_messaging_wakeup(int messaging) {
+    return queues[messaging].wakeup[0];
+}
+
+void clear_cgreen_messaging_wakeup(int messaging) {
+    char wakeups[64];
+
+    if (queues[messaging].wakeup[0] < 0)
+        return;
+    while (cgreen_pipe_read(queues[messaging].wakeup[0], wakeups, sizeof(wakeups)) > 0)
+        ;
+}
+
+/* If the pipe is already full the reader has not yet woken up from
+   the earlier ones, which is as good */
+static void wake_up_reader(CgreenMessageQueue *queue) {
+    if (write(queue->wakeup[1], "", 1) < 0)
+        return;
+}
+
+/* Let the reader know that there is something it should not wait for
+   the ring to fill up to see */
+void notify_cgreen_messaging_reader(int messaging) {
+    CgreenMessageQueue *queue = &queues[messaging];
+
+    if (uses_ring_for_writing(queue) && queue->owner != getpid())
+        wake_up_reader(queue);
+}
+
+static bool write_fragment_to_ring(CgreenMessageQueue *queue, CgreenMessage *header,
+                                   const void *payload, size_t size) {
+    if (cgreen_ring_write(queue->ring, header, sizeof(*header), payload, size))
+        return true;
+    if (queue->owner == getpid()) {
+        if (queue->drain == NULL)
+            return false;
+        (*queue->drain)(queue->reader);
+        return cgreen_ring_write(queue->ring, header, sizeof(*header), payload, size);
+    }
+    wake_up_reader(queue);
+    while (cgreen_ring_wait_for_room(queue->ring, sizeof(*header) + size, queue->owner))
+        if (cgreen_ring_write(queue->ring, header, sizeof(*header), payload, size))
+            return true;
+    return false;
+}
+
+/* If the rest of a fragmented message can't be written, all of it is
+   written to the pipe, and the reader drops the fragments it got */
+static bool write_to_ring(CgreenMessageQueue *queue, CgreenMessage *header, const void *payload, size_t size) {
+    size_t offset = 0;
+
+    do {
+        size_t fragment = size - offset < MESSAGE_FRAGMENT_SIZE ? size - offset : MESSAGE_FRAGMENT_SIZE;
+
+        header->fragment_offset = (int)offset;
+        header->fragment_size = (int)fragment;
+        if (!write_fragment_to_ring(queue, header, (const char *)payload + offset, fragment))
+            return false;
+        offset += fragment;
+    } while (offset < size);
+    return true;
+}
+
 void send_cgreen_message(int messaging, int result) {
+    send_cgreen_message_with_payload(messaging, result, NULL, 0);
+}
+
+/* A message with a payload is written in one go so that it can't be
+   interleaved with other messages, the payload directly following the
+   header */
+void send_cgreen_message_with_payload(int messaging, int result, const void *payload, size_t size) {
+    CgreenMessageQueue *queue = &queues[messaging];
+    CgreenMessage header;
     CgreenMessage *message;
-    
-    message = (CgreenMessage *) malloc(sizeof(CgreenMessage));
+
+    memset(&header, 0, sizeof(header));
+    header.type = queue->tag;
+    header.result = result;
+    header.payload_size = (int)size;
+
+    if (uses_ring_for_writing(queue)) {
+        if (write_to_ring(queue, &header, payload, size))
+            return;
+        queue->overflowed = true;
+    }
+    header.fragment_offset = 0;
+    header.fragment_size = (int)size;
+
+    message = (CgreenMessage *) malloc(sizeof(CgreenMessage) + size);
     if (message == NULL) {
       return;
     }
-    memset(message, 0, sizeof(*message));
-    message->type = queues[messaging].tag;
-    message->result = result;
-    cgreen_pipe_write(queues[messaging].writepipe, message, sizeof(CgreenMessage));
+    memcpy(message, &header, sizeof(header));
+    if (size > 0)
+        memcpy(message + 1, payload, size);
+    cgreen_pipe_write(queue->writepipe, message, sizeof(CgreenMessage) + size);
     // give the parent a chance to read so that failures are more likely to be output
     // before the child crashes
     sched_yield();
@@ -115,26 +261,131 @@ void send_cgreen_message(int messaging, int result) {
 }
 
 int receive_cgreen_message(int messaging) {
+    void *payload = NULL;
+    int result = receive_cgreen_message_with_payload(messaging, &payload, NULL);
+    free(payload);
+    return result;
+}
+
+static void drop_fragments(CgreenMessageQueue *queue) {
+    free(queue->fragments);
+    queue->fragments = NULL;
+    queue->fragments_size = 0;
+}
+
+static void skip_fragment(CgreenMessageQueue *queue, int size) {
+    char skipped[256];
+
+    while (size > 0) {
+        int count = size < (int)sizeof(skipped) ? size : (int)sizeof(skipped);
+        cgreen_ring_read(queue->ring, skipped, count);
+        size -= count;
+    }
+}
+
+/* A fragment is always written together with its header. One that
+   does not continue the payload being put together is what is left of
+   a message from a process that died before it was all written. */
+static bool add_fragment(CgreenMessageQueue *queue, CgreenMessage *message) {
+    if (message->fragment_offset == 0) {
+        drop_fragments(queue);
+        queue->fragments = (char *) malloc(message->payload_size);
+    }
+    if (queue->fragments == NULL || message->fragment_offset != queue->fragments_size
+        || message->fragment_size > message->payload_size - queue->fragments_size) {
+        skip_fragment(queue, message->fragment_size);
+        drop_fragments(queue);
+        return false;
+    }
+    cgreen_ring_read(queue->ring, queue->fragments + queue->fragments_size, message->fragment_size);
+    queue->fragments_size += message->fragment_size;
+    return true;
+}
+
+/* Reads the fragments of a message until it is complete, or there
+   are no more of them yet */
+static bool receive_from_ring(CgreenMessageQueue *queue, CgreenMessage *message, void **payload) {
+    while (cgreen_ring_read(queue->ring, message, sizeof(*message))) {
+        if (message->payload_size == 0)
+            return true;
+        if (!add_fragment(queue, message))
+            continue;
+        if (queue->fragments_size == message->payload_size) {
+            *payload = queue->fragments;
+            queue->fragments = NULL;
+            queue->fragments_size = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Anything in the ring was written before what overflowed into the
+   pipe. The size of the payload is given if 'size' is not NULL. */
+int receive_cgreen_message_with_payload(int messaging, void **payload, size_t *size) {
+    CgreenMessageQueue *queue = &queues[messaging];
     ssize_t received;
     int result;
-    CgreenMessage *message = (CgreenMessage *) malloc(sizeof(CgreenMessage));
-    if (message == NULL) {
-      return -1;
+    CgreenMessage message;
+
+    *payload = NULL;
+    if (size != NULL)
+        *size = 0;
+    if (uses_ring_for_reading(queue) && receive_from_ring(queue, &message, payload)) {
+        if (size != NULL && *payload != NULL)
+            *size = message.payload_size;
+        return message.result;
     }
 
-    received = cgreen_pipe_read(queues[messaging].readpipe, message, sizeof(CgreenMessage));
-    result = (received > 0 ? message->result : 0);
-    free(message);
+    received = cgreen_pipe_read(queue->readpipe, &message, sizeof(CgreenMessage));
+    if (received <= 0) {
+        /* Everything is read, so the ring can be used again */
+        queue->overflowed = false;
+        return 0;
+    }
+    drop_fragments(queue);
+    result = message.result;
+    if (message.payload_size > 0) {
+        *payload = malloc(message.payload_size);
+        if (*payload == NULL ||
+            cgreen_pipe_read(queue->readpipe, *payload, message.payload_size) != message.payload_size) {
+            free(*payload);
+            *payload = NULL;
+            result = 0;
+        } else if (size != NULL) {
+            *size = message.payload_size;
+        }
+    }
     return result;
 }
 
+/* Parallel runs let each test child write its messages to a file of
+   its own instead of the shared pipe, the parent then reads them back
+   from that file when it is the tests turn to be reported */
+void redirect_cgreen_messaging(int messaging, int readfd, int writefd) {
+    queues[messaging].readpipe = readfd;
+    queues[messaging].writepipe = writefd;
+}
+
+void restore_cgreen_messaging(int messaging) {
+    queues[messaging].readpipe = queues[messaging].pipes[0];
+    queues[messaging].writepipe = queues[messaging].pipes[1];
+}
+
 static void clean_up_messaging(void) {
     int i;
     for (i = 0; i < queue_count; i++) {
         if (queues[i].owner == getpid()) {
-            cgreen_pipe_close(queues[i].readpipe);
-            cgreen_pipe_close(queues[i].writepipe);
+            cgreen_pipe_close(queues[i].pipes[0]);
+            cgreen_pipe_close(queues[i].pipes[1]);
+            if (queues[i].wakeup[0] >= 0) {
+                cgreen_pipe_close(queues[i].wakeup[0]);
+                cgreen_pipe_close(queues[i].wakeup[1]);
+            }
         }
+        if (queues[i].ring != NULL)
+            cgreen_ring_close(queues[i].ring);
+        free(queues[i].fragments);
     }
     free(queues);
     queues = NULL;
@@ -2,6 +2,7 @@
 #include <cgreen/breadcrumb.h>
 #include <cgreen/mocks.h>
 #include <cgreen/boxed_double.h>
+#include <cgreen/message_formatting.h>
 #include <inttypes.h>
 // TODO: report PC-Lint bug about undeserved 451
 #include <stdarg.h>
@@ -11,6 +12,7 @@
 
 #include "cgreen_value_internal.h"
 #include "cgreen/cgreen_value.h"
+#include "cgreen/internal/cgreen_lock.h"
 #include "parameters.h"
 #include "constraint_internal.h"
 #include "utils.h"
@@ -20,7 +22,10 @@
 #include "cgreen/internal/android_headers/androidcompat.h"
 #endif // #ifdef __ANDROID__
 
-typedef struct RecordedExpectation_ {
+typedef struct MockedFunction_ MockedFunction;
+
+typedef struct RecordedExpectation_ RecordedExpectation;
+struct RecordedExpectation_ {
     const char *function;
     const char *test_file;
     int test_line;
@@ -33,29 +38,73 @@ typedef struct RecordedExpectation_ {
      * as a successful test if it as never been called
      */
     int times_triggered;
-} RecordedExpectation;
+
+    /* Expectations are kept in the order they were made, and for each
+       mocked function in a queue of its own */
+    MockedFunction *mocked_function;
+    RecordedExpectation *previous;
+    RecordedExpectation *next;
+    RecordedExpectation *next_for_function;
+};
+
+/* The expectations of a function are found through an index hashed on
+   its name, since the names in expect() and mock() are different
+   strings. It only lives as long as the expectations of a test, and
+   also counts the calls to the function in the test. */
+struct MockedFunction_ {
+    const char *name;
+    uint32_t hash;
+    MockedFunction *next_in_bucket;
+    RecordedExpectation *first;
+    RecordedExpectation *last;
+    int always_expectations;
+    int never_call_expectations;
+    int calls;
+    int successful_calls;
+};
 
 const int UNLIMITED_TIME_TO_LIVE = 0x0f314159;
 
 static CgreenMockMode cgreen_mocks_are_ = strict_mocks;
 static CgreenVector *learned_mock_calls = NULL;
-static CgreenVector *successfully_mocked_calls = NULL;
-static CgreenVector *global_expectation_queue = NULL;
-
-static CgreenVector *create_vector_of_actuals(va_list actuals, int count);
+static RecordedExpectation *first_expectation = NULL;
+static RecordedExpectation *last_expectation = NULL;
+static MockedFunction **mocked_functions = NULL;
+static uint32_t mocked_function_buckets = 0;
+static uint32_t mocked_function_count = 0;
+
+/* Only taken when the test uses threads, see cgreen_test_uses_threads() */
+static CgreenLock *lock_of_mocks = NULL;
+static bool mocks_are_locked = false;
+
+/* A mocked function always calls mock() with the same name, its
+   __func__, so the functions found are remembered by the pointer of
+   the name to not have to hash it on every call */
+#define RECENTLY_FOUND_FUNCTIONS 16
+static struct {
+    const char *name;
+    MockedFunction *mocked_function;
+} recently_found_functions[RECENTLY_FOUND_FUNCTIONS];
+
+static void read_actuals(va_list actuals, CgreenValue *actual_values, int count);
+static CgreenValue mock_with_arguments(TestReporter* test_reporter, const char *function, const char *mock_file,
+                                       int mock_line, const char *parameters, va_list actuals);
+static CgreenValue mock_with_actuals(TestReporter* test_reporter, const char *function, const char *mock_file,
+                                     int mock_line, CgreenVector *parameter_names, CgreenValue *actual_values);
 static CgreenVector *create_equal_value_constraints_for(CgreenVector *parameter_names,
-                                                        CgreenVector *actual_values);
+                                                        CgreenValue *actual_values);
 static CgreenVector *create_constraints_vector(void);
 static RecordedExpectation *create_recorded_expectation(const char *function, const char *test_file,
                                                         int test_line, CgreenVector *constraints);
 static CgreenVector *constraints_vector_from_va_list(va_list constraints);
 static void destroy_expectation(RecordedExpectation *expectation);
-static void ensure_expectation_queue_exists(void);
 static void ensure_learned_mock_calls_list_exists(void);
-static void ensure_successfully_mocked_calls_list_exists(void);
-static void remove_expectation_for(const char *function);
-static void trigger_unfulfilled_expectations(CgreenVector *expectation_queue, TestReporter *reporter);
-static RecordedExpectation *find_expectation(const char *function);
+static void add_expectation(RecordedExpectation *expectation);
+static void remove_expectation(RecordedExpectation *expectation);
+static void clear_expectations(void);
+static MockedFunction *mocked_function_named(const char *name);
+static MockedFunction *intern_mocked_function(const char *name);
+static void trigger_unfulfilled_expectations(TestReporter *reporter);
 static void apply_any_read_only_parameter_constraints(RecordedExpectation *expectation,
                                                       const char *parameter,
                                                       CgreenValue actual,
@@ -65,7 +114,6 @@ static void apply_any_content_setting_parameter_constraints(RecordedExpectation
                                                      CgreenValue actual,
                                                      TestReporter* test_reporter);
 static CgreenValue stored_result_or_default_for(CgreenVector* constraints);
-static int number_of_parameters_in(const char *parameter_list);
 static bool is_always_call(RecordedExpectation* expectation);
 static bool have_always_expectation_for(const char* function);
 static bool is_never_call(RecordedExpectation* expectation);
@@ -88,21 +136,27 @@ void cgreen_mocks_are(CgreenMockMode mock_mode) {
     cgreen_mocks_are_ = mock_mode;
 }
 
+/* Made from the thread of the test, before it starts any other, and
+   undone when the mocks are cleared at the end of the test */
+void cgreen_test_uses_threads(void) {
+    if (lock_of_mocks == NULL)
+        lock_of_mocks = cgreen_lock_create();
+    mocks_are_locked = true;
+    keep_assertions_of_other_threads();
+    lock_failure_messages_of_threads();
+}
 
-static int number_of_parameters_in(const char *parameter_list) {
-    int count = 1;
-    const char *current = parameter_list;
-
-    if (strlen(parameter_list) == 0) return 0;
-
-    while (*current != '\0') {
-        if (*current == ',') count++;
-        current++;
-    }
+static void take_lock_of_mocks(void) {
+    if (mocks_are_locked)
+        cgreen_lock_take(lock_of_mocks);
+}
 
-    return count;
+static void release_lock_of_mocks(void) {
+    if (mocks_are_locked)
+        cgreen_lock_release(lock_of_mocks);
 }
 
+
 /* Not used anywhere, but might become handy so make it non-static to avoid warnings */
 int number_of_parameter_constraints_in(const CgreenVector* constraints) {
     int i, parameters = 0;
@@ -119,7 +173,7 @@ int number_of_parameter_constraints_in(const CgreenVector* constraints) {
 }
 
 static void learn_mock_call_for(const char *function, const char *mock_file, int mock_line,
-                                CgreenVector *parameter_names, CgreenVector *actual_values) {
+                                CgreenVector *parameter_names, CgreenValue *actual_values) {
     CgreenVector *constraints = create_equal_value_constraints_for(parameter_names, actual_values);
 
     RecordedExpectation *expectation = create_recorded_expectation(function, mock_file, mock_line,
@@ -129,7 +183,7 @@ static void learn_mock_call_for(const char *function, const char *mock_file, int
 }
 
 static void handle_missing_expectation_for(const char *function, const char *mock_file, int mock_line,
-                                           CgreenVector *parameter_names, CgreenVector *actual_values,
+                                           CgreenVector *parameter_names, CgreenValue *actual_values,
                                            TestReporter *test_reporter) {
     RecordedExpectation *expectation;
     CgreenVector *no_constraints;
@@ -164,63 +218,127 @@ static bool parameter_is_boxed_double(CgreenVector *double_markers, int i) {
 }
 
 
-static void convert_boxed_doubles_to_cgreen_values(const char *parameters, CgreenVector *actual_values) {
-    CgreenVector *double_markers;
+static void convert_boxed_doubles_to_cgreen_values(const ParameterList *parameter_list, CgreenValue *actual_values) {
+    CgreenVector *double_markers = parameter_list->double_markers;
     int i;
     /* Since the caller must use 'box_double()' to pass doubles as
        arguments to 'mock()' we can know which ones are such parameters
        to be able to convert them to CgreenValues here */
-    double_markers = create_vector_of_double_markers_for(parameters);
     for (i = 0; i < cgreen_vector_size(double_markers); i++) {
         if (parameter_is_boxed_double(double_markers, i)) {
-            CgreenValue *actual = cgreen_vector_get(actual_values, i);
-            *actual = convert_boxed_double_to_cgreen_value(*actual);
+            actual_values[i] = convert_boxed_double_to_cgreen_value(actual_values[i]);
         }
     }
-    destroy_cgreen_vector(double_markers);
 }
 
 
+/* The actual values of a call with no more than this many parameters
+   are kept on the stack, so that the call allocates nothing */
+#define ACTUALS_ON_THE_STACK 16
+
 intptr_t mock_(TestReporter* test_reporter, const char *function, const char *mock_file, int mock_line, const char *parameters, ...) {
     va_list actuals;
-    CgreenVector *actual_values;
-    CgreenVector *parameter_names;
-    int failures_before_read_only_constraints_executed;
-    int failures_after_read_only_constraints_executed;
-    int i;
-    CgreenValue stored_result;
-    RecordedExpectation *expectation = find_expectation(function);
+    CgreenValue result;
+
+    va_start(actuals, parameters);
+    result = mock_with_arguments(test_reporter, function, mock_file, mock_line, parameters, actuals);
+    va_end(actuals);
+
+    if (result.type == DOUBLE) {
+#ifdef V2
+        /* TODO: for v2 we should ensure that the user is not trying to return a double
+           through 'mock()' when there is a 'mock_double()' available. So then
+
+               return unbox_double(mock(...));
 
-    parameter_names = create_vector_of_names(parameters);
+           should be replaced by
+
+               return mock_double(...);
+        */
+        test_reporter->assert_true(test_reporter,
+                                   mock_file,
+                                   mock_line,
+                                   false,
+                                   "Mocked function [%s] have a 'will_return_double()' expectation, "
+                                   "but 'mock()' cannot return doubles; Use 'mock_double()' instead",
+                                   function);
+        /* But we'll return it anyway, whatever it becomes is what he will get... */
+        return result.value.double_value;
+#else
+        /* ... but for now return a boxed double since the user is probably using
+
+               return unbox_double(mock(...));
+
+           as is the standard way in 1.x
+        */
+        return box_double(result.value.double_value);
+#endif
+    } else
+        return result.value.integer_value;
+}
+
+/* A result that is not a double is converted to one */
+double mock_double_(TestReporter* test_reporter, const char *function, const char *mock_file, int mock_line, const char *parameters, ...) {
+    va_list actuals;
+    CgreenValue result;
 
     va_start(actuals, parameters);
-    actual_values = create_vector_of_actuals(actuals, number_of_parameters_in(parameters));
+    result = mock_with_arguments(test_reporter, function, mock_file, mock_line, parameters, actuals);
     va_end(actuals);
 
-    convert_boxed_doubles_to_cgreen_values(parameters, actual_values);
+    if (result.type == DOUBLE)
+        return result.value.double_value;
+    return (double)result.value.integer_value;
+}
+
+static CgreenValue mock_with_arguments(TestReporter* test_reporter, const char *function, const char *mock_file,
+                                       int mock_line, const char *parameters, va_list actuals) {
+    CgreenValue actuals_on_the_stack[ACTUALS_ON_THE_STACK];
+    CgreenValue *actual_values = actuals_on_the_stack;
+    const ParameterList *parameter_list;
+    CgreenValue result;
+
+    take_lock_of_mocks();
+    parameter_list = parameter_list_for(parameters);
+    if (parameter_list->count > ACTUALS_ON_THE_STACK)
+        actual_values = (CgreenValue *)malloc(parameter_list->count * sizeof(CgreenValue));
+
+    read_actuals(actuals, actual_values, parameter_list->count);
+    convert_boxed_doubles_to_cgreen_values(parameter_list, actual_values);
+
+    result = mock_with_actuals(test_reporter, function, mock_file, mock_line,
+                               parameter_list->names, actual_values);
+
+    if (actual_values != actuals_on_the_stack)
+        free(actual_values);
+    release_lock_of_mocks();
+    return result;
+}
+
+static CgreenValue mock_with_actuals(TestReporter* test_reporter, const char *function, const char *mock_file,
+                                     int mock_line, CgreenVector *parameter_names, CgreenValue *actual_values) {
+    int failures_before_read_only_constraints_executed;
+    int failures_after_read_only_constraints_executed;
+    int i;
+    CgreenValue stored_result;
+    MockedFunction *mocked_function = intern_mocked_function(function);
+    RecordedExpectation *expectation = mocked_function->first;
 
+    mocked_function->calls++;
     if (expectation == NULL) {
         handle_missing_expectation_for(function, mock_file, mock_line, parameter_names, actual_values, test_reporter);
-        destroy_cgreen_vector(actual_values);
-        destroy_cgreen_vector(parameter_names);
-        return 0;
+        return make_cgreen_integer_value(0);
     }
 
     if (is_never_call(expectation)) {
         expectation->times_triggered++;
         report_violated_never_call(test_reporter, expectation);
-        destroy_cgreen_vector(actual_values);
-        destroy_cgreen_vector(parameter_names);
-        return 0;
+        return make_cgreen_integer_value(0);
     }
 
-    ensure_successfully_mocked_calls_list_exists();
-    cgreen_vector_add(successfully_mocked_calls, (void*)function);
+    mocked_function->successful_calls++;
 
     stored_result = stored_result_or_default_for(expectation->constraints);
-    // FIXME: Should verify that return value is not a DOUBLE as `mock_()' can not
-    // return them. There should also be a 'mock_double_()' which does the same except
-    // returning a double.
 
     for (i = 0; i < cgreen_vector_size(expectation->constraints); i++) {
         Constraint *constraint = (Constraint *)cgreen_vector_get(expectation->constraints, i);
@@ -237,15 +355,13 @@ intptr_t mock_(TestReporter* test_reporter, const char *function, const char *mo
 
         if (!is_parameter(constraint)) continue;
 
-        if (!constraint_is_for_parameter_in(constraint, parameters)) {
+        if (!constraint_is_for_parameter_in(constraint, parameter_names)) {
             // if expectation parameter name isn't in parameter_names,
             // fail test and skip applying constraints unlikely to match
             report_mock_parameter_name_not_found(test_reporter, expectation, constraint->parameter_name);
             destroy_expectation_if_time_to_die(expectation);
-            destroy_cgreen_vector(actual_values);
-            destroy_cgreen_vector(parameter_names);
 
-            return stored_result.value.integer_value;
+            return stored_result;
         }
     }
 
@@ -255,7 +371,7 @@ intptr_t mock_(TestReporter* test_reporter, const char *function, const char *mo
 
     for (i = 0; i < cgreen_vector_size(parameter_names); i++) {
         const char* parameter_name = (const char*)cgreen_vector_get(parameter_names, i);
-        CgreenValue actual = *(CgreenValue*)cgreen_vector_get(actual_values, i);
+        CgreenValue actual = actual_values[i];
         apply_any_read_only_parameter_constraints(expectation, parameter_name, actual, test_reporter);
     }
 
@@ -267,49 +383,16 @@ intptr_t mock_(TestReporter* test_reporter, const char *function, const char *mo
     if (failures_before_read_only_constraints_executed == failures_after_read_only_constraints_executed) {
         for (i = 0; i < cgreen_vector_size(parameter_names); i++) {
             const char* parameter_name = (const char*)cgreen_vector_get(parameter_names, i);
-            CgreenValue actual = *(CgreenValue*)cgreen_vector_get(actual_values, i);
+            CgreenValue actual = actual_values[i];
             apply_any_content_setting_parameter_constraints(expectation, parameter_name, actual, test_reporter);
         }
     }
 
-    destroy_cgreen_vector(parameter_names);
-    destroy_cgreen_vector(actual_values);
 
     expectation->times_triggered++;
     destroy_expectation_if_time_to_die(expectation);
 
-    if (stored_result.type == DOUBLE) {
-#ifdef V2
-        /* TODO: for v2 we should ensure that the user is not trying to return a double
-           through 'mock()' when there is a 'mock_double()' available, which there isn't yet.
-           So then
-
-               return unbox_double(mock(...));
-
-           should be replaced by
-
-               return mock_double(...);
-        */
-        test_reporter->assert_true(test_reporter,
-                                   mock_file,
-                                   mock_line,
-                                   false,
-                                   "Mocked function [%s] have a 'will_return_double()' expectation, "
-                                   "but 'mock()' cannot return doubles; Use 'mock_double()' instead",
-                                   function);
-        /* But we'll return it anyway, whatever it becomes is what he will get... */
-        return stored_result.value.double_value;
-#else
-        /* ... but for now return a boxed double since the user is probably using
-
-               return unbox_double(mock(...));
-
-           as is the standard way in 1.x
-        */
-        return box_double(stored_result.value.double_value);
-#endif
-    } else
-        return stored_result.value.integer_value;
+    return stored_result;
 }
 
 static void apply_side_effect(TestReporter *test_reporter,
@@ -329,14 +412,12 @@ static
 bool
 is_side_effect_constraint(const Constraint *constraint) { return constraint->type == CALL; }
 
-static CgreenVector *create_vector_of_actuals(va_list actuals, int count) {
+static void read_actuals(va_list actuals, CgreenValue *actual_values, int count) {
     int i;
-    CgreenVector *actual_values = create_cgreen_vector(free);
     for (i = 0; i < count; i++) {
         uintptr_t actual = va_arg(actuals, uintptr_t);
-        cgreen_vector_add(actual_values, (void*)create_cgreen_value(make_cgreen_integer_value(actual)));
+        actual_values[i] = make_cgreen_integer_value(actual);
     }
-    return actual_values;
 }
 
 
@@ -344,23 +425,22 @@ static Constraint *create_appropriate_equal_constraint_for(const char *parameter
                                                            CgreenValue actual) {
     Constraint *constraint;
     if (actual.type == DOUBLE)
-        constraint = create_equal_to_double_constraint(actual.value.double_value,
+        constraint = create_equal_to_double_constraint_in(NULL, actual.value.double_value,
                                                        parameter_name);
     else
-        constraint = create_equal_to_value_constraint(actual.value.integer_value,
+        constraint = create_equal_to_value_constraint_in(NULL, actual.value.integer_value,
                                                       parameter_name);
     return constraint;
 }
 
 static CgreenVector *create_equal_value_constraints_for(CgreenVector *parameter_names,
-                                                        CgreenVector *actual_values) {
+                                                        CgreenValue *actual_values) {
     int i;
     CgreenVector *constraints = create_constraints_vector();
     for (i = 0; i < cgreen_vector_size(parameter_names); i++) {
         const char* parameter_name = (const char*)cgreen_vector_get(parameter_names, i);
-        CgreenValue actual = *(CgreenValue*)cgreen_vector_get(actual_values, i);
-        Constraint *constraint = create_appropriate_equal_constraint_for(parameter_name, actual);
-        cgreen_vector_add(constraints, constraint);
+        Constraint *constraint = create_appropriate_equal_constraint_for(parameter_name, actual_values[i]);
+        cgreen_vector_add(constraints, keep_constraint(constraint));
     }
     return constraints;
 }
@@ -375,20 +455,15 @@ Constraint *when_(const char *parameter, Constraint* constraint) {
 
 void test_times_called(Constraint *constraint, const char *function, CgreenValue actual,
                const char *test_file, int test_line, TestReporter *reporter) {
-    char *message;
-    char parameter_name_actual_string[255];
-
-    snprintf(parameter_name_actual_string, sizeof(parameter_name_actual_string) - 1, "%s", function);
-    message = constraint->failure_message(constraint, parameter_name_actual_string, actual.value.integer_value);
-
-    (*reporter->assert_true)(
-            reporter,
-            test_file,
-            test_line,
-            (*constraint->compare)(constraint, actual),
-            message);
-
-    free(message);
+    CgreenEvent event;
+
+    memset(&event, 0, sizeof(event));
+    event.file = test_file;
+    event.line = test_line;
+    event.constraint = constraint->name;
+    event.expression = function;
+    event.expected = constraint->expected_value_name;
+    show_comparison(reporter, &event, constraint, actual);
 }
 
 Constraint *times_(const int number_times_called) {
@@ -415,7 +490,7 @@ static void destroy_expectation_if_time_to_die(RecordedExpectation *expectation)
     expectation->time_to_live--;
 
     if (expectation->time_to_live <= 0) {
-        remove_expectation_for(expectation->function);
+        remove_expectation(expectation);
         destroy_expectation(expectation);
     }
 }
@@ -425,6 +500,7 @@ void expect_(TestReporter* test_reporter, const char *function, const char *test
     RecordedExpectation *expectation;
     CgreenVector *constraints_vector;
 
+    take_lock_of_mocks();
     if (have_always_expectation_for(function)) {
         test_reporter->assert_true(
                 test_reporter,
@@ -437,6 +513,7 @@ void expect_(TestReporter* test_reporter, const char *function, const char *test
         destroy_constraints(constraints);
         va_end(constraints);
 
+        release_lock_of_mocks();
         return;
     }
 
@@ -454,6 +531,7 @@ void expect_(TestReporter* test_reporter, const char *function, const char *test
         destroy_constraints(constraints);
         va_end(constraints);
 
+        release_lock_of_mocks();
         return;
     }
 
@@ -471,7 +549,8 @@ void expect_(TestReporter* test_reporter, const char *function, const char *test
             break;
         }
     }
-    cgreen_vector_add(global_expectation_queue, expectation);
+    add_expectation(expectation);
+    release_lock_of_mocks();
 }
 
 void always_expect_(TestReporter* test_reporter, const char *function, const char *test_file, int test_line, ...) {
@@ -479,6 +558,7 @@ void always_expect_(TestReporter* test_reporter, const char *function, const cha
     RecordedExpectation *expectation;
     CgreenVector *constraints_vector;
 
+    take_lock_of_mocks();
     if (have_always_expectation_for(function)) {
         test_reporter->assert_true(
                 test_reporter,
@@ -491,6 +571,7 @@ void always_expect_(TestReporter* test_reporter, const char *function, const cha
         destroy_constraints(constraints);
         va_end(constraints);
 
+        release_lock_of_mocks();
         return;
     }
 
@@ -508,6 +589,7 @@ void always_expect_(TestReporter* test_reporter, const char *function, const cha
         destroy_constraints(constraints);
         va_end(constraints);
 
+        release_lock_of_mocks();
         return;
     }
 
@@ -516,7 +598,8 @@ void always_expect_(TestReporter* test_reporter, const char *function, const cha
     expectation = create_recorded_expectation(function, test_file, test_line, constraints_vector);
     va_end(constraints);
     expectation->time_to_live = UNLIMITED_TIME_TO_LIVE;
-    cgreen_vector_add(global_expectation_queue, expectation);
+    add_expectation(expectation);
+    release_lock_of_mocks();
 }
 
 void never_expect_(TestReporter* test_reporter, const char *function, const char *test_file, int test_line, ...) {
@@ -524,6 +607,7 @@ void never_expect_(TestReporter* test_reporter, const char *function, const char
     RecordedExpectation *expectation;
     CgreenVector *constraints_vector;
 
+    take_lock_of_mocks();
     if (have_always_expectation_for(function)) {
         test_reporter->assert_true(
                 test_reporter,
@@ -536,6 +620,7 @@ void never_expect_(TestReporter* test_reporter, const char *function, const char
         destroy_constraints(constraints);
         va_end(constraints);
 
+        release_lock_of_mocks();
         return;
     }
 
@@ -553,6 +638,7 @@ void never_expect_(TestReporter* test_reporter, const char *function, const char
         destroy_constraints(constraints);
         va_end(constraints);
 
+        release_lock_of_mocks();
         return;
     }
 
@@ -560,7 +646,8 @@ void never_expect_(TestReporter* test_reporter, const char *function, const char
     constraints_vector = constraints_vector_from_va_list(constraints);
     expectation = create_recorded_expectation(function, test_file, test_line, constraints_vector);
     expectation->time_to_live = -UNLIMITED_TIME_TO_LIVE;
-    cgreen_vector_add(global_expectation_queue, expectation);
+    add_expectation(expectation);
+    release_lock_of_mocks();
 }
 
 
@@ -576,16 +663,20 @@ static void report_violated_never_call(TestReporter *test_reporter, RecordedExpe
 
 
 static bool successfully_mocked_call(const char *function_name) {
-    int i;
+    MockedFunction *mocked_function = mocked_function_named(function_name);
 
-    for (i = 0; i < cgreen_vector_size(successfully_mocked_calls); i++) {
-        const char *successfully_mocked_function_name = (const char *)cgreen_vector_get(successfully_mocked_calls, i);
-        if (strcmp(successfully_mocked_function_name, function_name) == 0) {
-            return true;
-        }
-    }
+    return mocked_function != NULL && mocked_function->successful_calls > 0;
+}
+
+int number_of_calls_to_(const char *function) {
+    MockedFunction *mocked_function;
+    int calls;
 
-    return false;
+    take_lock_of_mocks();
+    mocked_function = mocked_function_named(function);
+    calls = mocked_function != NULL ? mocked_function->calls : 0;
+    release_lock_of_mocks();
+    return calls;
 }
 
 
@@ -607,10 +698,9 @@ static void report_unexpected_call(TestReporter *test_reporter, RecordedExpectat
 }
 
 void clear_mocks(void) {
-    if (global_expectation_queue != NULL) {
-        destroy_cgreen_vector(global_expectation_queue);
-        global_expectation_queue = NULL;
-    }
+    mocks_are_locked = false;
+    clear_expectations();
+    forget_parameter_lists();
 
     if (learned_mock_calls != NULL) {
         int i;
@@ -622,6 +712,7 @@ void clear_mocks(void) {
         destroy_cgreen_vector(learned_mock_calls);
         learned_mock_calls = NULL;
     }
+
 }
 
 static void show_breadcrumb(const char *name, void *memo) {
@@ -670,7 +761,8 @@ void tally_mocks(TestReporter *reporter) {
         print_learned_mocks();
     }
 
-    trigger_unfulfilled_expectations(global_expectation_queue, reporter);
+    show_assertions_of_other_threads(reporter);
+    trigger_unfulfilled_expectations(reporter);
     clear_mocks();
 }
 
@@ -684,7 +776,7 @@ static CgreenVector *constraints_vector_from_va_list(va_list constraints) {
     CgreenVector *vector = create_constraints_vector();
     Constraint *constraint;
     while ((constraint = va_arg(constraints, Constraint *)) != (Constraint *)0) {
-        cgreen_vector_add(vector, constraint);
+        cgreen_vector_add(vector, keep_constraint(constraint));
     }
     return vector;
 }
@@ -693,7 +785,6 @@ static CgreenVector *constraints_vector_from_va_list(va_list constraints) {
 static RecordedExpectation *create_recorded_expectation(const char *function, const char *test_file, int test_line, CgreenVector *constraints) {
     RecordedExpectation *expectation;
 
-    ensure_expectation_queue_exists();
     expectation = (RecordedExpectation *)malloc(sizeof(RecordedExpectation));
     expectation->function = function;
     expectation->test_file = test_file;
@@ -701,6 +792,10 @@ static RecordedExpectation *create_recorded_expectation(const char *function, co
     expectation->constraints = constraints;
     expectation->number_times_called = 0;
     expectation->times_triggered = 0;
+    expectation->mocked_function = NULL;
+    expectation->previous = NULL;
+    expectation->next = NULL;
+    expectation->next_for_function = NULL;
 
     return expectation;
 }
@@ -718,13 +813,6 @@ static void destroy_expectation(RecordedExpectation *expectation) {
     free(expectation);
 }
 
-static void ensure_successfully_mocked_calls_list_exists(void) {
-    if (successfully_mocked_calls == NULL) {
-        // successfully_mocked_calls are __func__, so there's nothing to destroy
-        successfully_mocked_calls = create_cgreen_vector(NULL);
-    }
-}
-
 static void ensure_learned_mock_calls_list_exists(void) {
     if (learned_mock_calls == NULL) {
         // learned_mock_calls are __func__, so there's nothing to destroy
@@ -732,43 +820,184 @@ static void ensure_learned_mock_calls_list_exists(void) {
     }
 }
 
-static void ensure_expectation_queue_exists(void) {
-    if (global_expectation_queue == NULL) {
-        global_expectation_queue = create_cgreen_vector((GenericDestructor)&destroy_expectation);
+static uint32_t hash_of_name(const char *name) {
+    uint32_t hash = 2166136261u;
+
+    while (*name != '\0') {
+        hash = (hash ^ (unsigned char)*name++) * 16777619u;
     }
+    return hash;
 }
 
-static void remove_expectation_for(const char *function) {
-    int i;
-    for (i = 0; i < cgreen_vector_size(global_expectation_queue); i++) {
-        RecordedExpectation *expectation = (RecordedExpectation *)cgreen_vector_get(global_expectation_queue, i);
+static MockedFunction *mocked_function_named(const char *name) {
+    uint32_t hash;
+    MockedFunction *mocked_function;
+    int recent = (int)(((uintptr_t)name >> 3) % RECENTLY_FOUND_FUNCTIONS);
 
-        if (NULL == expectation) {
-            fprintf(stderr, "*** CGREEN: NULL expectation found -- maybe a previous incorrect removal?");
-            continue;
+    if (recently_found_functions[recent].name == name) {
+        return recently_found_functions[recent].mocked_function;
+    }
+
+    if (mocked_functions == NULL) {
+        return NULL;
+    }
+
+    hash = hash_of_name(name);
+    for (mocked_function = mocked_functions[hash & (mocked_function_buckets - 1)];
+         mocked_function != NULL;
+         mocked_function = mocked_function->next_in_bucket) {
+        if (mocked_function->hash == hash && strcmp(mocked_function->name, name) == 0) {
+            recently_found_functions[recent].name = name;
+            recently_found_functions[recent].mocked_function = mocked_function;
+            return mocked_function;
         }
+    }
+    return NULL;
+}
 
-        if (strcmp(expectation->function, function) == 0) {
-            cgreen_vector_remove(global_expectation_queue, i);
-            return;
+static void rehash_mocked_functions(uint32_t buckets) {
+    MockedFunction **rehashed = (MockedFunction **)calloc(buckets, sizeof(MockedFunction *));
+    uint32_t i;
+
+    for (i = 0; i < mocked_function_buckets; i++) {
+        MockedFunction *mocked_function = mocked_functions[i];
+        while (mocked_function != NULL) {
+            MockedFunction *next = mocked_function->next_in_bucket;
+            mocked_function->next_in_bucket = rehashed[mocked_function->hash & (buckets - 1)];
+            rehashed[mocked_function->hash & (buckets - 1)] = mocked_function;
+            mocked_function = next;
         }
     }
+    free(mocked_functions);
+    mocked_functions = rehashed;
+    mocked_function_buckets = buckets;
 }
 
-static bool is_first_call_matching(RecordedExpectation *expectation) {
-    return expectation->times_triggered == 0;
+static MockedFunction *intern_mocked_function(const char *name) {
+    MockedFunction *mocked_function = mocked_function_named(name);
+    uint32_t bucket;
+
+    if (mocked_function != NULL) {
+        return mocked_function;
+    }
+
+    if (mocked_function_count >= mocked_function_buckets) {
+        rehash_mocked_functions(mocked_function_buckets == 0 ? 64 : 2 * mocked_function_buckets);
+    }
+
+    mocked_function = (MockedFunction *)malloc(sizeof(MockedFunction));
+    mocked_function->name = name;
+    mocked_function->hash = hash_of_name(name);
+    mocked_function->first = NULL;
+    mocked_function->last = NULL;
+    mocked_function->always_expectations = 0;
+    mocked_function->never_call_expectations = 0;
+    mocked_function->calls = 0;
+    mocked_function->successful_calls = 0;
+
+    bucket = mocked_function->hash & (mocked_function_buckets - 1);
+    mocked_function->next_in_bucket = mocked_functions[bucket];
+    mocked_functions[bucket] = mocked_function;
+    mocked_function_count++;
+
+    return mocked_function;
 }
 
+static void count_expectation(MockedFunction *mocked_function, RecordedExpectation *expectation, int count) {
+    if (is_always_call(expectation)) {
+        mocked_function->always_expectations += count;
+    } else if (is_never_call(expectation)) {
+        mocked_function->never_call_expectations += count;
+    }
+}
 
-static void trigger_unfulfilled_expectations(CgreenVector *expectation_queue, TestReporter *reporter) {
-    for (int e = 0; e < cgreen_vector_size(expectation_queue); e++) {
-        RecordedExpectation *expectation = (RecordedExpectation *)cgreen_vector_get(expectation_queue, e);
+/* The time to live has to be set before, since it tells if it is an
+   always or a never call expectation */
+static void add_expectation(RecordedExpectation *expectation) {
+    MockedFunction *mocked_function = intern_mocked_function(expectation->function);
 
-        if (NULL == expectation) {
-            fprintf(stderr, "*** NULL unfulfilled cgreen expectation found -- maybe a previous incorrect removal?");
-            continue;
+    expectation->mocked_function = mocked_function;
+    if (mocked_function->last == NULL) {
+        mocked_function->first = expectation;
+    } else {
+        mocked_function->last->next_for_function = expectation;
+    }
+    mocked_function->last = expectation;
+    count_expectation(mocked_function, expectation, 1);
+
+    expectation->previous = last_expectation;
+    if (last_expectation == NULL) {
+        first_expectation = expectation;
+    } else {
+        last_expectation->next = expectation;
+    }
+    last_expectation = expectation;
+}
+
+static void remove_expectation(RecordedExpectation *expectation) {
+    MockedFunction *mocked_function = expectation->mocked_function;
+    RecordedExpectation *previous_for_function = NULL;
+    RecordedExpectation *current;
+
+    /* it is nearly always the first one, that is the one that is used */
+    for (current = mocked_function->first; current != expectation; current = current->next_for_function) {
+        previous_for_function = current;
+    }
+    if (previous_for_function == NULL) {
+        mocked_function->first = expectation->next_for_function;
+    } else {
+        previous_for_function->next_for_function = expectation->next_for_function;
+    }
+    if (mocked_function->last == expectation) {
+        mocked_function->last = previous_for_function;
+    }
+    count_expectation(mocked_function, expectation, -1);
+
+    if (expectation->previous == NULL) {
+        first_expectation = expectation->next;
+    } else {
+        expectation->previous->next = expectation->next;
+    }
+    if (expectation->next == NULL) {
+        last_expectation = expectation->previous;
+    } else {
+        expectation->next->previous = expectation->previous;
+    }
+}
+
+static void clear_expectations(void) {
+    uint32_t i;
+
+    while (first_expectation != NULL) {
+        RecordedExpectation *expectation = first_expectation;
+        first_expectation = expectation->next;
+        destroy_expectation(expectation);
+    }
+    last_expectation = NULL;
+
+    for (i = 0; i < mocked_function_buckets; i++) {
+        while (mocked_functions[i] != NULL) {
+            MockedFunction *mocked_function = mocked_functions[i];
+            mocked_functions[i] = mocked_function->next_in_bucket;
+            free(mocked_function);
         }
+    }
+    free(mocked_functions);
+    mocked_functions = NULL;
+    mocked_function_buckets = 0;
+    mocked_function_count = 0;
+    memset(recently_found_functions, 0, sizeof(recently_found_functions));
+}
+
+static bool is_first_call_matching(RecordedExpectation *expectation) {
+    return expectation->times_triggered == 0;
+}
 
+
+static void trigger_unfulfilled_expectations(TestReporter *reporter) {
+    RecordedExpectation *expectation;
+
+    for (expectation = first_expectation; expectation != NULL; expectation = expectation->next) {
         if (is_always_call(expectation)) {
             continue;
         }
@@ -809,19 +1038,6 @@ static void trigger_unfulfilled_expectations(CgreenVector *expectation_queue, Te
     }
 }
 
-static RecordedExpectation *find_expectation(const char *function) {
-    int i;
-    for (i = 0; i < cgreen_vector_size(global_expectation_queue); i++) {
-        RecordedExpectation *expectation =
-            (RecordedExpectation *)cgreen_vector_get(global_expectation_queue, i);
-
-        if (strcmp(expectation->function, function) == 0) {
-            return expectation;
-        }
-    }
-    return NULL;
-}
-
 static void report_mock_parameter_name_not_found(TestReporter *test_reporter, RecordedExpectation *expectation, const char *constraint_parameter_name) {
 
     test_reporter->assert_true(
@@ -902,18 +1118,9 @@ static bool is_always_call(RecordedExpectation* expectation) {
 }
 
 static bool have_always_expectation_for(const char* function) {
-    int i;
-    for (i = 0; i < cgreen_vector_size(global_expectation_queue); i++) {
-        RecordedExpectation *expectation =
-                (RecordedExpectation *)cgreen_vector_get(global_expectation_queue, i);
-        if (strcmp(expectation->function, function) == 0) {
-            if (is_always_call(expectation)) {
-                return true;
-            }
-        }
-    }
+    MockedFunction *mocked_function = mocked_function_named(function);
 
-    return false;
+    return mocked_function != NULL && mocked_function->always_expectations > 0;
 }
 
 static bool is_never_call(RecordedExpectation* expectation) {
@@ -921,34 +1128,32 @@ static bool is_never_call(RecordedExpectation* expectation) {
 }
 
 static bool have_never_call_expectation_for(const char* function) {
-    int i;
-    for (i = 0; i < cgreen_vector_size(global_expectation_queue); i++) {
-        RecordedExpectation *expectation =
-                (RecordedExpectation *)cgreen_vector_get(global_expectation_queue, i);
-        if (strcmp(expectation->function, function) == 0) {
-            if (is_never_call(expectation)) {
-                return true;
-            }
-        }
-    }
+    MockedFunction *mocked_function = mocked_function_named(function);
 
-    return false;
+    return mocked_function != NULL && mocked_function->never_call_expectations > 0;
 }
 
 static bool remove_never_call_expectation_for(const char* function) {
-    int i;
-    for (i = 0; i < cgreen_vector_size(global_expectation_queue); i++) {
-        RecordedExpectation *expectation =
-                (RecordedExpectation *)cgreen_vector_get(global_expectation_queue, i);
-        if (strcmp(expectation->function, function) == 0) {
-            if (is_never_call(expectation)) {
-                cgreen_vector_remove(global_expectation_queue, i);
-                destroy_expectation(expectation);
-            }
+    MockedFunction *mocked_function = mocked_function_named(function);
+    RecordedExpectation *expectation;
+    bool removed = false;
+
+    if (mocked_function == NULL) {
+        return false;
+    }
+
+    expectation = mocked_function->first;
+    while (expectation != NULL) {
+        RecordedExpectation *next = expectation->next_for_function;
+        if (is_never_call(expectation)) {
+            remove_expectation(expectation);
+            destroy_expectation(expectation);
+            removed = true;
         }
+        expectation = next;
     }
 
-    return false;
+    return removed;
 }
 
 /* vim: set ts=4 sw=4 et cindent: */
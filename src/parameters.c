@@ -3,6 +3,7 @@
 #include <stdbool.h>
 #include <string.h>
 #include <ctype.h>
+#include <stdint.h>
 
 #include "parameters.h"
 
@@ -12,6 +13,14 @@ static char *end_of_token(char *token);
 static char *strip_function_from(char *token, const char *function_name);
 static bool begins_with(char *token, const char *beginning);
 
+#define INITIAL_PARAMETER_LIST_SLOTS 64
+
+/* Open addressed on the pointer of the list, with room for twice as
+   many as there are */
+static ParameterList **parameter_lists = NULL;
+static int parameter_list_slots = 0;
+static int parameter_list_count = 0;
+
 static char *stringdup(const char *string) {
     return strcpy((char *)malloc(strlen(string)+1), string);
 }
@@ -89,6 +98,91 @@ CgreenVector *create_vector_of_double_markers_for(const char *parameters) {
     return markers;
 }
 
+static int number_of_parameters_in(const char *parameters) {
+    int count = 1;
+    const char *current = parameters;
+
+    if (parameters == NULL || *parameters == '\0') return 0;
+
+    while (*current != '\0') {
+        if (*current == ',') count++;
+        current++;
+    }
+
+    return count;
+}
+
+static uint32_t slot_of(const char *parameters, int slots) {
+    uintptr_t key = (uintptr_t)parameters;
+    return (uint32_t)((key ^ (key >> 16)) * 2654435761u) & (uint32_t)(slots - 1);
+}
+
+static ParameterList **slot_for(ParameterList **lists, int slots, const char *parameters) {
+    uint32_t slot = slot_of(parameters, slots);
+
+    while (lists[slot] != NULL && lists[slot]->parameters != parameters)
+        slot = (slot + 1) & (uint32_t)(slots - 1);
+    return &lists[slot];
+}
+
+static void make_room_for_another_parameter_list(void) {
+    ParameterList **lists;
+    int slots = parameter_list_slots == 0 ? INITIAL_PARAMETER_LIST_SLOTS : 2*parameter_list_slots;
+    int i;
+
+    if (2*(parameter_list_count + 1) <= parameter_list_slots)
+        return;
+
+    lists = (ParameterList **)calloc(slots, sizeof(ParameterList *));
+    for (i = 0; i < parameter_list_slots; i++)
+        if (parameter_lists[i] != NULL)
+            *slot_for(lists, slots, parameter_lists[i]->parameters) = parameter_lists[i];
+    free(parameter_lists);
+    parameter_lists = lists;
+    parameter_list_slots = slots;
+}
+
+const ParameterList *parameter_list_for(const char *parameters) {
+    ParameterList **slot;
+    ParameterList *list;
+
+    if (parameter_lists != NULL) {
+        slot = slot_for(parameter_lists, parameter_list_slots, parameters);
+        if (*slot != NULL)
+            return *slot;
+    }
+
+    make_room_for_another_parameter_list();
+    list = (ParameterList *)malloc(sizeof(ParameterList));
+    list->parameters = parameters;
+    list->count = number_of_parameters_in(parameters);
+    list->names = create_vector_of_names(parameters);
+    list->double_markers = create_vector_of_double_markers_for(parameters);
+    *slot_for(parameter_lists, parameter_list_slots, parameters) = list;
+    parameter_list_count++;
+    return list;
+}
+
+int number_of_parsed_parameter_lists(void) {
+    return parameter_list_count;
+}
+
+void forget_parameter_lists(void) {
+    int i;
+
+    for (i = 0; i < parameter_list_slots; i++) {
+        if (parameter_lists[i] != NULL) {
+            destroy_cgreen_vector(parameter_lists[i]->names);
+            destroy_cgreen_vector(parameter_lists[i]->double_markers);
+            free(parameter_lists[i]);
+        }
+    }
+    free(parameter_lists);
+    parameter_lists = NULL;
+    parameter_list_slots = 0;
+    parameter_list_count = 0;
+}
+
 static char *tokenise_by_commas_and_whitespace(char *list) {
     size_t i, length;
 
@@ -2,6 +2,7 @@
 #define PARAMETERS_HEADER
 
 #include <cgreen/vector.h>
+#include <stdbool.h>
 
 /* Parameters are used from some user level tests so must be compilable in C++ */
 #ifdef __cplusplus
@@ -12,6 +13,21 @@ namespace cgreen {
 CgreenVector *create_vector_of_names(const char *parameters);
 CgreenVector *create_vector_of_double_markers_for(const char *parameters);
 
+/* The parameter list of a call to mock() is the stringified arguments
+   of the call site, so the same list is always the same string. It is
+   parsed the first time it is seen and then looked up by its pointer
+   until the parsed lists are forgotten. */
+typedef struct {
+    const char *parameters;
+    int count;
+    CgreenVector *names;
+    CgreenVector *double_markers;
+} ParameterList;
+
+const ParameterList *parameter_list_for(const char *parameters);
+int number_of_parsed_parameter_lists(void);
+void forget_parameter_lists(void);
+
 #ifdef __cplusplus
     }
 }
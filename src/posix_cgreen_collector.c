@@ -0,0 +1,175 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "cgreen/internal/cgreen_collector.h"
+#include "cgreen/internal/runner_platform.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/syscall.h>
+#define CGREEN_COLLECTOR_USES_EPOLL
+#endif
+
+#ifdef __ANDROID__
+#include "cgreen/internal/android_headers/androidcompat.h"
+#endif // #ifdef __ANDROID__
+
+typedef struct {
+    int fd;
+    bool owned;                 /* Closed when forgotten */
+    void *context;
+} Watch;
+
+struct CgreenCollector_ {
+    int epoll;                  /* -1 when poll() is used instead */
+    Watch *watches;
+    int count;
+    int capacity;
+};
+
+CgreenCollector *cgreen_collector_open(void) {
+    CgreenCollector *collector = (CgreenCollector *) calloc(1, sizeof(CgreenCollector));
+
+    if (collector == NULL) {
+        die("Could not allocate memory for collecting test results\n");
+    }
+    collector->epoll = -1;
+#ifdef CGREEN_COLLECTOR_USES_EPOLL
+    collector->epoll = epoll_create1(EPOLL_CLOEXEC);
+#endif
+    return collector;
+}
+
+void cgreen_collector_close(CgreenCollector *collector) {
+    while (collector->count > 0)
+        cgreen_collector_forget(collector, collector->watches[0].context);
+    if (collector->epoll >= 0)
+        close(collector->epoll);
+    free(collector->watches);
+    free(collector);
+}
+
+static void watch(CgreenCollector *collector, int fd, bool owned, void *context) {
+    Watch *added;
+
+    if (collector->count == collector->capacity) {
+        int capacity = collector->capacity > 0 ? 2*collector->capacity : 16;
+        Watch *watches = (Watch *) realloc(collector->watches, capacity * sizeof(Watch));
+        if (watches == NULL) {
+            die("Could not allocate memory for collecting test results\n");
+        }
+        collector->watches = watches;
+        collector->capacity = capacity;
+    }
+    added = &collector->watches[collector->count++];
+    added->fd = fd;
+    added->owned = owned;
+    added->context = context;
+
+#ifdef CGREEN_COLLECTOR_USES_EPOLL
+    if (collector->epoll >= 0) {
+        struct epoll_event event;
+
+        event.events = EPOLLIN;
+        event.data.ptr = context;
+        if (epoll_ctl(collector->epoll, EPOLL_CTL_ADD, fd, &event) != 0) {
+            die("Could not watch test process\n");
+        }
+    }
+#endif
+}
+
+/* A pidfd can't be held on to by a process the test forks, as its
+   exit pipe can, so it is used when the system has them */
+static int open_pidfd(pid_t pid) {
+#if defined(__linux__) && defined(SYS_pidfd_open)
+    return (int)syscall(SYS_pidfd_open, pid, 0);
+#else
+    (void)pid;
+    return -1;
+#endif
+}
+
+void cgreen_collector_watch_exit(CgreenCollector *collector, pid_t pid, int exit_pipe, void *context) {
+    int pidfd = open_pidfd(pid);
+
+    if (pidfd >= 0) {
+        close(exit_pipe);
+        watch(collector, pidfd, true, context);
+    } else {
+        watch(collector, exit_pipe, true, context);
+    }
+}
+
+void cgreen_collector_watch_channel(CgreenCollector *collector, int channel, void *context) {
+    watch(collector, channel, false, context);
+}
+
+void cgreen_collector_forget(CgreenCollector *collector, void *context) {
+    int i;
+
+    for (i = 0; i < collector->count; i++) {
+        if (collector->watches[i].context == context) {
+#ifdef CGREEN_COLLECTOR_USES_EPOLL
+            if (collector->epoll >= 0)
+                epoll_ctl(collector->epoll, EPOLL_CTL_DEL, collector->watches[i].fd, NULL);
+#endif
+            if (collector->watches[i].owned)
+                close(collector->watches[i].fd);
+            collector->watches[i] = collector->watches[--collector->count];
+            return;
+        }
+    }
+}
+
+static int wait_with_poll(CgreenCollector *collector, int timeout, void **ready, int size) {
+    struct pollfd *fds = (struct pollfd *) calloc(collector->count > 0 ? collector->count : 1,
+                                                  sizeof(struct pollfd));
+    int found = 0;
+    int i;
+
+    if (fds == NULL) {
+        die("Could not allocate memory for collecting test results\n");
+    }
+    for (i = 0; i < collector->count; i++) {
+        fds[i].fd = collector->watches[i].fd;
+        fds[i].events = POLLIN;
+    }
+    if (poll(fds, collector->count, timeout) > 0) {
+        for (i = 0; i < collector->count && found < size; i++)
+            if (fds[i].revents != 0)
+                ready[found++] = collector->watches[i].context;
+    }
+    free(fds);
+    return found;
+}
+
+/* Waits at most 'timeout' milliseconds, or forever if it is negative,
+   and gives the contexts of at most 'size' of the watched that are
+   ready. Those that are not given are still ready the next time. */
+int cgreen_collector_wait(CgreenCollector *collector, int timeout, void **ready, int size) {
+#ifdef CGREEN_COLLECTOR_USES_EPOLL
+    if (collector->epoll >= 0) {
+        struct epoll_event events[64];
+        int found;
+        int i;
+
+        if (size > (int)(sizeof(events)/sizeof(events[0])))
+            size = sizeof(events)/sizeof(events[0]);
+        found = epoll_wait(collector->epoll, events, size, timeout);
+        for (i = 0; i < found; i++)
+            ready[i] = events[i].data.ptr;
+        return found > 0 ? found : 0;
+    }
+#endif
+    return wait_with_poll(collector, timeout, ready, size);
+}
+
+/* vim: set ts=4 sw=4 et cindent: */
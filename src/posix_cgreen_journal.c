@@ -0,0 +1,48 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "cgreen/internal/cgreen_journal.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#ifdef __ANDROID__
+#include "cgreen/internal/android_headers/androidcompat.h"
+#endif // #ifdef __ANDROID__
+
+/* The file is created with its full size but without any blocks, so
+   that only the records that are written take up room on disk. What
+   is written to the pages is kept by the system even if the process
+   that wrote it crashes. */
+CgreenJournalHeader *cgreen_journal_map(const char *filename, size_t size) {
+    void *journal;
+    int fd = open(filename, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+    if (fd < 0)
+        return NULL;
+    if (ftruncate(fd, (off_t)size) != 0) {
+        close(fd);
+        return NULL;
+    }
+    journal = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    return journal != MAP_FAILED ? (CgreenJournalHeader *)journal : NULL;
+}
+
+/* Returns NULL when the journal is full, the tail is counted up anyway
+   so that it can be seen how many records were lost */
+CgreenJournalRecord *cgreen_journal_reserve(CgreenJournalHeader *journal) {
+    uint64_t index = __atomic_fetch_add(&journal->tail, 1, __ATOMIC_RELAXED);
+
+    if (index >= journal->capacity)
+        return NULL;
+    return (CgreenJournalRecord *)((char *)journal + (index + 1) * journal->record_size);
+}
+
+void cgreen_journal_publish(CgreenJournalRecord *record, CgreenJournalRecordType type) {
+    __atomic_store_n(&record->type, (uint32_t)type, __ATOMIC_RELEASE);
+}
+
+/* vim: set ts=4 sw=4 et cindent: */
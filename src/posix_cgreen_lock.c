@@ -0,0 +1,35 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "cgreen/internal/cgreen_lock.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+struct CgreenLock_ {
+    pthread_mutex_t mutex;
+};
+
+CgreenLock *cgreen_lock_create(void) {
+    pthread_mutexattr_t attributes;
+    CgreenLock *lock = (CgreenLock *)malloc(sizeof(CgreenLock));
+
+    if (lock == NULL)
+        return NULL;
+    pthread_mutexattr_init(&attributes);
+    pthread_mutexattr_settype(&attributes, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&lock->mutex, &attributes);
+    pthread_mutexattr_destroy(&attributes);
+    return lock;
+}
+
+void cgreen_lock_take(CgreenLock *lock) {
+    pthread_mutex_lock(&lock->mutex);
+}
+
+void cgreen_lock_release(CgreenLock *lock) {
+    pthread_mutex_unlock(&lock->mutex);
+}
+
+/* vim: set ts=4 sw=4 et cindent: */
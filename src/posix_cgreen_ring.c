@@ -0,0 +1,131 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "cgreen/internal/cgreen_ring.h"
+
+#include <sched.h>
+#include <signal.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+
+#ifdef __ANDROID__
+#include "cgreen/internal/android_headers/androidcompat.h"
+#endif // #ifdef __ANDROID__
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/* The positions only ever grow, the writer owns 'written' and the
+   reader owns 'read'. Each publishes its position after it is done
+   with the data, so neither needs a lock. */
+struct CgreenRing_ {
+    uint64_t written;
+    uint64_t read;
+    size_t size;                /* A power of two */
+    unsigned char data[1];
+};
+
+#define RING_HEADER_SIZE offsetof(struct CgreenRing_, data)
+
+static void copy_into(CgreenRing *ring, uint64_t position, const void *source, size_t count);
+static void copy_from(CgreenRing *ring, uint64_t position, void *destination, size_t count);
+
+
+/* The pages are shared with children forked later on, and are only
+   backed by memory when they are used */
+CgreenRing *cgreen_ring_open(size_t size) {
+    CgreenRing *ring;
+    size_t power_of_two = 1;
+
+    while (power_of_two < size)
+        power_of_two *= 2;
+    ring = (CgreenRing *) mmap(NULL, RING_HEADER_SIZE + power_of_two, PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (ring == MAP_FAILED)
+        return NULL;
+    ring->written = 0;
+    ring->read = 0;
+    ring->size = power_of_two;
+    return ring;
+}
+
+void cgreen_ring_close(CgreenRing *ring) {
+    munmap(ring, RING_HEADER_SIZE + ring->size);
+}
+
+bool cgreen_ring_write(CgreenRing *ring, const void *header, size_t header_size,
+                       const void *payload, size_t payload_size) {
+    uint64_t written = ring->written;
+    uint64_t read = __atomic_load_n(&ring->read, __ATOMIC_ACQUIRE);
+
+    if (ring->size - (written - read) < header_size + payload_size)
+        return false;
+    copy_into(ring, written, header, header_size);
+    copy_into(ring, written + header_size, payload, payload_size);
+    __atomic_store_n(&ring->written, written + header_size + payload_size, __ATOMIC_RELEASE);
+    return true;
+}
+
+static bool has_room_for(CgreenRing *ring, size_t count) {
+    return ring->size - (ring->written - __atomic_load_n(&ring->read, __ATOMIC_ACQUIRE)) >= count;
+}
+
+/* Give the reader a moment, and then some more, to make room, as long
+   as it is still there. Messages too large for the ring never fit. */
+bool cgreen_ring_wait_for_room(CgreenRing *ring, size_t count, pid_t reader) {
+    struct timespec pause = { 0, 10000 };
+    int yields = 0;
+
+    if (count > ring->size)
+        return false;
+    while (!has_room_for(ring, count)) {
+        if (kill(reader, 0) != 0)
+            return false;
+        if (yields < 100) {
+            sched_yield();
+            yields++;
+        } else {
+            nanosleep(&pause, NULL);
+            if (pause.tv_nsec < 1000000)
+                pause.tv_nsec *= 2;
+        }
+    }
+    return true;
+}
+
+bool cgreen_ring_read(CgreenRing *ring, void *buffer, size_t count) {
+    uint64_t read = ring->read;
+    uint64_t written = __atomic_load_n(&ring->written, __ATOMIC_ACQUIRE);
+
+    if (written - read < count)
+        return false;
+    copy_from(ring, read, buffer, count);
+    __atomic_store_n(&ring->read, read + count, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool cgreen_ring_is_empty(CgreenRing *ring) {
+    return __atomic_load_n(&ring->written, __ATOMIC_ACQUIRE) == ring->read;
+}
+
+static void copy_into(CgreenRing *ring, uint64_t position, const void *source, size_t count) {
+    size_t offset = (size_t)(position & (ring->size - 1));
+    size_t first = count < ring->size - offset ? count : ring->size - offset;
+
+    memcpy(ring->data + offset, source, first);
+    memcpy(ring->data, (const unsigned char *)source + first, count - first);
+}
+
+static void copy_from(CgreenRing *ring, uint64_t position, void *destination, size_t count) {
+    size_t offset = (size_t)(position & (ring->size - 1));
+    size_t first = count < ring->size - offset ? count : ring->size - offset;
+
+    memcpy(destination, ring->data + offset, first);
+    memcpy((unsigned char *)destination + first, ring->data, count - first);
+}
+
+/* vim: set ts=4 sw=4 et cindent: */
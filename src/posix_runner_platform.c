@@ -8,43 +8,188 @@
 #include "runner.h"
 #include "cgreen/internal/runner_platform.h"
 #include <stdio.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <unistd.h>
 #include <sys/wait.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <cgreen/internal/cgreen_collector.h>
 #include <cgreen/internal/cgreen_time.h>
+#include <cgreen/messaging.h>
+#include <cgreen/mocks.h>
 
 #ifdef __ANDROID__
 #include "cgreen/internal/android_headers/androidcompat.h"
 #endif // #ifdef __ANDROID__
 
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
 
 typedef void (*sighandler_t)(int);
 
-static int in_child_process(void);
-static int wait_for_child_process(void);
+static pid_t fork_test_process(void);
+static int wait_for_child_process_within(pid_t child, int exit_pipe, unsigned int timeout,
+                                         bool *timed_out, TestReporter *reporter);
+static pid_t reap_child_process(pid_t child, int options, int *status, CgreenResourceUsage *usage);
+static void create_exit_pipe(int exit_pipe[2]);
+static int kill_child_process(pid_t child, CgreenResourceUsage *usage);
+static void resource_usage_between(CgreenResourceUsage *usage, const struct rusage *before,
+                                   const struct rusage *after);
+static uint64_t monotonic_milliseconds(void);
+static int milliseconds_until(uint64_t deadline);
+static int *share_pass_counters(int count);
+static void unshare_pass_counters(int *counters, int count);
+static int take_unsent_passes(int *counter);
 static void stop(void);
 static void ignore_ctrl_c(void);
 static void allow_ctrl_c(void);
 
 
+typedef enum { JOB_WAITING, JOB_RUNNING, JOB_FINISHED } JobState;
+
+typedef struct TestJob_ {
+    CgreenTest *test;
+    JobState state;
+    pid_t pid;
+    int status;
+    uint64_t starting_time;
+    uint64_t duration;
+    unsigned int timeout;
+    uint64_t deadline;          /* Monotonic milliseconds, 0 if none */
+    bool timed_out;
+    CgreenResourceUsage usage;
+    int *pass_counter;          /* Shared with the test process */
+    int unsent_passes;
+    FILE *results;
+    FILE *output;
+    FILE *errors;
+} TestJob;
+
+/* Finished jobs are kept, with their files, until it is their turn to
+   be reported, so limit how far ahead of reporting we are allowed to
+   run to not run out of file descriptors */
+#define JOBS_AHEAD_FACTOR 8
+
+/* Running jobs and workers are watched by one collector, so that
+   waiting for any of them doesn't depend on how many there are */
+static CgreenCollector *collector = NULL;
+
+static CgreenCollector *collector_of_this_run(void) {
+    if (collector == NULL)
+        collector = cgreen_collector_open();
+    return collector;
+}
+
+#define READY_AT_A_TIME 64
+
+static void start_job(TestSuite *suite, TestJob *job, TestReporter *reporter);
+static void report_job(TestJob *job, TestReporter *reporter);
+static void wait_for_any_job(TestJob *jobs, int count);
+
+
+/* A worker is a child process that is reused for many tests. The
+   parent sends it orders over the control pipe, and for each test it
+   answers on the done pipe when the test is finished. Reporter
+   messages and output from the worker go to files that are moved to
+   the job once the test is finished, so that reporting can be done
+   in the same way as for a test run in a process of its own. */
+typedef struct Worker_ {
+    pid_t pid;
+    int control;
+    int done;
+    bool retire_when_dirty;
+    int *pass_counter;          /* Shared with the worker */
+    FILE *results;
+    FILE *output;
+    FILE *errors;
+    TestJob *job;
+} Worker;
+
+/* The suite and test are created before any worker is forked, so
+   their addresses, like those of functions, are valid in the worker too */
+typedef enum { RUN_TEST, CALL_FUNCTION, SET_BREADCRUMB } WorkOrderType;
+
+typedef struct WorkOrder_ {
+    WorkOrderType type;
+    TestSuite *suite;
+    CgreenTest *test;
+    void (*function)(void);
+    int depth;
+} WorkOrder;
+
+enum { WORKER_CLEAN = 'c', WORKER_DIRTY = 'd' };
+
+static void start_worker(Worker *workers, int count, Worker *worker,
+                         bool retire_when_dirty, TestReporter *reporter);
+static void serve_orders(Worker *worker, int control, int done, TestReporter *reporter);
+static void send_order(Worker *worker, WorkOrderType type, TestSuite *suite, CgreenTest *test);
+static void send_function(Worker *worker, void (*function)(void));
+static void send_breadcrumb(Worker *worker, CgreenBreadcrumb *breadcrumb);
+static void dispatch_job(Worker *worker, TestSuite *suite, TestJob *job);
+static void wait_for_any_worker(Worker *workers, int count);
+static void stop_worker(Worker *worker);
+
+
+/* Shared with each test process in turn */
+static int *pass_counter_of_test_process = NULL;
+
 void run_test_in_its_own_process(TestSuite *suite, CgreenTest *test, TestReporter *reporter) {
-    uint32_t test_starting_milliseconds = cgreen_time_get_current_milliseconds();
+    uint64_t test_starting_time = cgreen_time_get_current_nanoseconds();
+    unsigned int timeout = timeout_for(suite, test);
+    int exit_pipe[2];
+    pid_t child;
 
     (*reporter->start_test)(reporter, test->name);
     if (test->skip) {
         send_reporter_skipped_notification(reporter);
         (*reporter->finish_test)(reporter, test->filename, test->line, NULL);
-    } else if (in_child_process()) {
+        return;
+    }
+
+    if (pass_counter_of_test_process == NULL)
+        pass_counter_of_test_process = share_pass_counters(1);
+    reporter->duration_ns = 0;
+    create_exit_pipe(exit_pipe);
+    child = fork_test_process();
+    if (child == 0) {
+        close(exit_pipe[0]);
+        defer_reporter_output(reporter);
+        count_unsent_passes_in(reporter, pass_counter_of_test_process);
         run_the_test_code(suite, test, reporter);
         send_reporter_completion_notification(reporter);
         stop();
     } else {
-        const int status = wait_for_child_process();
-        reporter->duration = cgreen_time_duration_in_milliseconds(test_starting_milliseconds,
-                                                                      cgreen_time_get_current_milliseconds());
+        bool timed_out = false;
+        int status;
+
+        close(exit_pipe[1]);
+        status = wait_for_child_process_within(child, exit_pipe[0], timeout, &timed_out, reporter);
+        close(exit_pipe[0]);
+        /* The test process sends how long the test took, which may
+           already have been read while waiting for it. If not, the
+           time measured here, which includes the fork, is kept in case
+           it never got to send it, and is replaced if it did. */
+        if (reporter->duration_ns == 0)
+            reporter->duration_ns = cgreen_time_duration_in_nanoseconds(test_starting_time,
+                                                                          cgreen_time_get_current_nanoseconds());
+        reporter->passes += take_unsent_passes(pass_counter_of_test_process);
+        if (timed_out) {
+            char buf[128];
+            snprintf(buf, sizeof(buf), "Test timed out after %u ms", timeout);
+            (*reporter->finish_test)(reporter, test->filename, test->line, buf);
+            return;
+        }
         if (WIFSIGNALED(status)) {
             /* a C++ exception generates SIGABRT. Only print our special message for other signals. */
             const int sig = WTERMSIG(status);
@@ -60,23 +205,804 @@ void run_test_in_its_own_process(TestSuite *suite, CgreenTest *test, TestReporte
     }
 }
 
-static int in_child_process(void) {
+/* Run the tests with at most 'jobs' child processes at a time, but
+   report them in the order they appear in the suite, so the output is
+   the same as when they are run one by one */
+void run_tests_in_parallel_processes(TestSuite *suite, CgreenTest **tests, int count,
+                                     TestReporter *reporter, int jobs) {
+    TestJob *job_table = (TestJob *) calloc(count > 0 ? count : 1, sizeof(TestJob));
+    int *pass_counters = share_pass_counters(count > 0 ? count : 1);
+    int next_to_start = 0;
+    int next_to_report = 0;
+    int running = 0;
+    int i;
+
+    if (job_table == NULL) {
+        die("Could not allocate memory for parallel test run\n");
+    }
+    for (i = 0; i < count; i++) {
+        job_table[i].test = tests[i];
+        job_table[i].state = JOB_WAITING;
+        job_table[i].pass_counter = &pass_counters[i];
+    }
+
+    while (next_to_report < count) {
+        while (running < jobs && next_to_start < count
+               && next_to_start - next_to_report < jobs * JOBS_AHEAD_FACTOR) {
+            start_job(suite, &job_table[next_to_start], reporter);
+            if (job_table[next_to_start].state == JOB_RUNNING)
+                running++;
+            next_to_start++;
+        }
+
+        if (job_table[next_to_report].state == JOB_FINISHED) {
+            report_job(&job_table[next_to_report], reporter);
+            next_to_report++;
+        } else {
+            wait_for_any_job(job_table, next_to_start);
+            running = 0;
+            for (i = next_to_report; i < next_to_start; i++)
+                if (job_table[i].state == JOB_RUNNING)
+                    running++;
+        }
+    }
+
+    unshare_pass_counters(pass_counters, count > 0 ? count : 1);
+    free(job_table);
+}
+
+static void start_job(TestSuite *suite, TestJob *job, TestReporter *reporter) {
+    int exit_pipe[2];
+    pid_t child;
+
+    if (job->test->skip) {
+        job->state = JOB_FINISHED;
+        return;
+    }
+
+    job->results = tmpfile();
+    job->output = tmpfile();
+    job->errors = tmpfile();
+    if (job->results == NULL || job->output == NULL || job->errors == NULL) {
+        die("Could not create temporary files for parallel test run\n");
+    }
+    create_exit_pipe(exit_pipe);
+
+    job->timeout = timeout_for(suite, job->test);
+    job->deadline = job->timeout > 0 ? monotonic_milliseconds() + job->timeout : 0;
+    job->starting_time = cgreen_time_get_current_nanoseconds();
+    child = fork_test_process();
+
+    if (child == 0) {
+        close(exit_pipe[0]);
+        dup2(fileno(job->output), STDOUT_FILENO);
+        dup2(fileno(job->errors), STDERR_FILENO);
+        redirect_cgreen_messaging(reporter->ipc, -1, fileno(job->results));
+        defer_reporter_output(reporter);
+        count_unsent_passes_in(reporter, job->pass_counter);
+        reporter_start_test(reporter, job->test->name);
+        run_the_test_code(suite, job->test, reporter);
+        send_reporter_completion_notification(reporter);
+        stop();
+    }
+
+    close(exit_pipe[1]);
+    cgreen_collector_watch_exit(collector_of_this_run(), child, exit_pipe[0], job);
+    job->pid = child;
+    job->state = JOB_RUNNING;
+}
+
+static void finish_job(TestJob *job, int status) {
+    cgreen_collector_forget(collector_of_this_run(), job);
+    job->status = status;
+    job->duration = cgreen_time_duration_in_nanoseconds(job->starting_time,
+                                                         cgreen_time_get_current_nanoseconds());
+    job->unsent_passes = take_unsent_passes(job->pass_counter);
+    job->state = JOB_FINISHED;
+}
+
+/* Wait until any of the running jobs exits or has to be killed for
+   running past its deadline */
+static void wait_for_any_job(TestJob *jobs, int count) {
+    void *ready[READY_AT_A_TIME];
+    uint64_t deadline = 0;
+    uint64_t now;
+    int found = 0;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        if (jobs[i].state == JOB_RUNNING && jobs[i].deadline != 0
+            && (deadline == 0 || jobs[i].deadline < deadline))
+            deadline = jobs[i].deadline;
+    }
+
+    ignore_ctrl_c();
+    if (deadline == 0 || deadline > monotonic_milliseconds())
+        found = cgreen_collector_wait(collector_of_this_run(), milliseconds_until(deadline),
+                                      ready, READY_AT_A_TIME);
+
+    /* The process can be waited for when it is seen to exit */
+    for (i = 0; i < found; i++) {
+        TestJob *job = (TestJob *)ready[i];
+        int status = 0;
+        reap_child_process(job->pid, 0, &status, &job->usage);
+        finish_job(job, status);
+    }
+
+    now = monotonic_milliseconds();
+    for (i = 0; i < count; i++) {
+        if (jobs[i].state == JOB_RUNNING && jobs[i].deadline != 0 && jobs[i].deadline <= now) {
+            jobs[i].timed_out = true;
+            finish_job(&jobs[i], kill_child_process(jobs[i].pid, &jobs[i].usage));
+        }
+    }
+    allow_ctrl_c();
+}
+
+static void transfer_output_from(FILE *output, FILE *destination) {
+    char buffer[4096];
+    size_t length;
+
+    fflush(destination);
+    rewind(output);
+    while ((length = fread(buffer, 1, sizeof(buffer), output)) > 0)
+        fwrite(buffer, 1, length, destination);
+    fflush(destination);
+}
+
+static void report_job(TestJob *job, TestReporter *reporter) {
+    const char *message = NULL;
+    char buf[128];
+
+    (*reporter->start_test)(reporter, job->test->name);
+    if (job->test->skip) {
+        send_reporter_skipped_notification(reporter);
+        (*reporter->finish_test)(reporter, job->test->filename, job->test->line, NULL);
+        return;
+    }
+
+    transfer_output_from(job->output, stdout);
+    transfer_output_from(job->errors, stderr);
+    rewind(job->results);
+    redirect_cgreen_messaging(reporter->ipc, fileno(job->results), -1);
+
+    reporter->duration_ns = job->duration;
+    reporter->resource_usage = job->usage;
+    reporter->passes += job->unsent_passes;
+    if (job->timed_out) {
+        snprintf(buf, sizeof(buf), "Test timed out after %u ms", job->timeout);
+        message = buf;
+    } else if (WIFSIGNALED(job->status)) {
+        /* a C++ exception generates SIGABRT. Only print our special message for other signals. */
+        const int sig = WTERMSIG(job->status);
+        if (sig != SIGABRT) {
+            snprintf(buf, sizeof(buf), "Test terminated with signal: %s", (const char *)strsignal(sig));
+            message = buf;
+        }
+    }
+    (*reporter->finish_test)(reporter, job->test->filename, job->test->line, message);
+
+    restore_cgreen_messaging(reporter->ipc);
+    fclose(job->results);
+    fclose(job->output);
+    fclose(job->errors);
+}
+
+/* Like run_tests_in_parallel_processes() but instead of forking a
+   new process for each test a pool of workers is kept. A worker is
+   replaced if it crashes, and if 'retire_when_dirty', also when a test
+   fails, since the worker might then have been left in a dirty state */
+void run_tests_in_worker_pool(TestSuite *suite, CgreenTest **tests, int count,
+                              TestReporter *reporter, int workers, bool retire_when_dirty) {
+    TestJob *job_table = (TestJob *) calloc(count > 0 ? count : 1, sizeof(TestJob));
+    Worker *pool = (Worker *) calloc(workers, sizeof(Worker));
+    int next_to_start = 0;
+    int next_to_report = 0;
+    int i;
+
+    if (job_table == NULL || pool == NULL) {
+        die("Could not allocate memory for worker pool\n");
+    }
+    for (i = 0; i < count; i++) {
+        job_table[i].test = tests[i];
+        job_table[i].state = JOB_WAITING;
+    }
+
+    while (next_to_report < count) {
+        for (i = 0; i < workers; i++) {
+            while (pool[i].job == NULL && next_to_start < count
+                   && next_to_start - next_to_report < workers * JOBS_AHEAD_FACTOR) {
+                TestJob *job = &job_table[next_to_start++];
+                if (job->test->skip) {
+                    job->state = JOB_FINISHED;
+                    continue;
+                }
+                if (pool[i].pid == 0) {
+                    start_worker(pool, workers, &pool[i], retire_when_dirty, reporter);
+                }
+                dispatch_job(&pool[i], suite, job);
+            }
+        }
+
+        if (job_table[next_to_report].state == JOB_FINISHED) {
+            report_job(&job_table[next_to_report], reporter);
+            next_to_report++;
+        } else {
+            wait_for_any_worker(pool, workers);
+        }
+    }
+
+    for (i = 0; i < workers; i++)
+        if (pool[i].pid != 0)
+            stop_worker(&pool[i]);
+
+    free(pool);
+    free(job_table);
+}
+
+
+/* With isolation per library a single worker runs all tests, in all
+   suites. The setup and teardown that the parent normally runs
+   outside of the tests are then instead run in the worker, and if the
+   worker has to be replaced the new worker is set up the same way */
+static Worker library_worker;
+static void (**entered_setups)(void) = NULL;
+static int entered_setups_count = 0;
+
+void run_tests_in_library_worker(TestSuite *suite, CgreenTest **tests, int count,
+                                 TestReporter *reporter) {
+    TestJob job;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        memset(&job, 0, sizeof(job));
+        job.test = tests[i];
+        if (job.test->skip) {
+            report_job(&job, reporter);
+            continue;
+        }
+
+        if (library_worker.pid == 0) {
+            int s;
+            start_worker(&library_worker, 1, &library_worker, false, reporter);
+            for (s = 0; s < entered_setups_count; s++)
+                send_function(&library_worker, entered_setups[s]);
+        }
+        send_breadcrumb(&library_worker, reporter->breadcrumb);
+        dispatch_job(&library_worker, suite, &job);
+        while (job.state != JOB_FINISHED)
+            wait_for_any_worker(&library_worker, 1);
+        report_job(&job, reporter);
+    }
+}
+
+void run_setup_in_library_worker(void (*setup)(void)) {
+    void (**tmp)(void) = (void (**)(void)) realloc(entered_setups,
+                                                   sizeof(setup) * (entered_setups_count + 1));
+    if (tmp == NULL) {
+        die("Could not allocate memory for library worker\n");
+    }
+    entered_setups = tmp;
+    entered_setups[entered_setups_count++] = setup;
+
+    if (library_worker.pid != 0)
+        send_function(&library_worker, setup);
+}
+
+void run_teardown_in_library_worker(void (*teardown)(void)) {
+    entered_setups_count--;
+
+    if (library_worker.pid != 0)
+        send_function(&library_worker, teardown);
+}
+
+void stop_library_worker(void) {
+    if (library_worker.pid != 0)
+        stop_worker(&library_worker);
+    free(entered_setups);
+    entered_setups = NULL;
+    entered_setups_count = 0;
+}
+
+static FILE *appending_tmpfile(void) {
+    FILE *file = tmpfile();
+    if (file == NULL) {
+        die("Could not create temporary files for worker process\n");
+    }
+    fcntl(fileno(file), F_SETFL, fcntl(fileno(file), F_GETFL) | O_APPEND);
+    return file;
+}
+
+static void start_worker(Worker *workers, int count, Worker *worker,
+                         bool retire_when_dirty, TestReporter *reporter) {
+    int control[2];
+    int done[2];
+    pid_t child;
+    int i;
+
+    worker->results = appending_tmpfile();
+    worker->output = appending_tmpfile();
+    worker->errors = appending_tmpfile();
+    worker->retire_when_dirty = retire_when_dirty;
+    worker->pass_counter = share_pass_counters(1);
+    if (pipe(control) != 0 || pipe(done) != 0) {
+        die("Could not create pipes for worker process\n");
+    }
+
+    fflush(NULL);
+    child = fork();
+    if (child < 0) {
+        die("Could not fork process\n");
+    }
+
+    if (child == 0) {
+        /* The other workers must see their pipes close when the parent closes them */
+        for (i = 0; i < count; i++) {
+            if (&workers[i] != worker && workers[i].pid != 0) {
+                close(workers[i].control);
+                close(workers[i].done);
+            }
+        }
+        close(control[1]);
+        close(done[0]);
+        serve_orders(worker, control[0], done[1], reporter);
+        stop();
+    }
+
+    close(control[0]);
+    close(done[1]);
+    worker->pid = child;
+    worker->control = control[1];
+    worker->done = done[0];
+}
+
+/* If the worker has died, e.g. in a suite setup, writing will fail,
+   but that is detected, and reported, when waiting for the next test */
+static void write_to_worker(Worker *worker, const void *buffer, size_t size) {
+    sighandler_t previous = signal(SIGPIPE, SIG_IGN);
+    ssize_t written;
+    do {
+        written = write(worker->control, buffer, size);
+    } while (written < 0 && errno == EINTR);
+    signal(SIGPIPE, previous);
+}
+
+static void send_order(Worker *worker, WorkOrderType type, TestSuite *suite, CgreenTest *test) {
+    WorkOrder order;
+
+    memset(&order, 0, sizeof(order));
+    order.type = type;
+    order.suite = suite;
+    order.test = test;
+    write_to_worker(worker, &order, sizeof(order));
+}
+
+static void send_function(Worker *worker, void (*function)(void)) {
+    WorkOrder order;
+
+    memset(&order, 0, sizeof(order));
+    order.type = CALL_FUNCTION;
+    order.function = function;
+    write_to_worker(worker, &order, sizeof(order));
+}
+
+/* The worker might have been started in another suite, so its
+   breadcrumb needs to be the same as the parents when running a test */
+static void send_breadcrumb(Worker *worker, CgreenBreadcrumb *breadcrumb) {
+    WorkOrder order;
+
+    memset(&order, 0, sizeof(order));
+    order.type = SET_BREADCRUMB;
+    order.depth = breadcrumb->depth;
+    write_to_worker(worker, &order, sizeof(order));
+    write_to_worker(worker, breadcrumb->trail, sizeof(const char *) * breadcrumb->depth);
+}
+
+static void dispatch_job(Worker *worker, TestSuite *suite, TestJob *job) {
+    job->timeout = timeout_for(suite, job->test);
+    job->deadline = job->timeout > 0 ? monotonic_milliseconds() + job->timeout : 0;
+    job->starting_time = cgreen_time_get_current_nanoseconds();
+    job->state = JOB_RUNNING;
+    worker->job = job;
+    cgreen_collector_watch_channel(collector_of_this_run(), worker->done, worker);
+    send_order(worker, RUN_TEST, suite, job->test);
+}
+
+static bool read_fully(int fd, void *buffer, size_t size) {
+    size_t total = 0;
+    while (total < size) {
+        ssize_t length = read(fd, (char *)buffer + total, size - total);
+        if (length <= 0)
+            return false;
+        total += length;
+    }
+    return true;
+}
+
+static void run_ordered_test(TestSuite *suite, CgreenTest *test, TestReporter *reporter) {
+    /* Mock mode is set by the tests themselves, so restore the default */
+    cgreen_mocks_are(strict_mocks);
+    reporter->failures = 0;
+    reporter->exceptions = 0;
+    reporter_start_test(reporter, test->name);
+    run_the_test_code(suite, test, reporter);
+    alarm(0);
+    send_reporter_completion_notification(reporter);
+    pop_breadcrumb((CgreenBreadcrumb *)reporter->breadcrumb);
+    fflush(NULL);
+}
+
+static void serve_orders(Worker *worker, int control, int done, TestReporter *reporter) {
+    CgreenBreadcrumb *breadcrumb = (CgreenBreadcrumb *)reporter->breadcrumb;
+    WorkOrder order;
+    CgreenResourceUsage usage;
+    char state;
+    int i;
+
+    dup2(fileno(worker->output), STDOUT_FILENO);
+    dup2(fileno(worker->errors), STDERR_FILENO);
+    redirect_cgreen_messaging(reporter->ipc, -1, fileno(worker->results));
+    defer_reporter_output(reporter);
+    count_unsent_passes_in(reporter, worker->pass_counter);
+
+    while (read_fully(control, &order, sizeof(order))) {
+        switch (order.type) {
+        case CALL_FUNCTION:
+            (*order.function)();
+            break;
+        case SET_BREADCRUMB:
+            while (get_breadcrumb_depth(breadcrumb) > 0)
+                pop_breadcrumb(breadcrumb);
+            for (i = 0; i < order.depth; i++) {
+                const char *name;
+                if (!read_fully(control, &name, sizeof(name)))
+                    return;
+                push_breadcrumb(breadcrumb, name);
+            }
+            break;
+        case RUN_TEST:
+            start_resource_measurement_in_this_process();
+            run_ordered_test(order.suite, order.test, reporter);
+            finish_resource_measurement_in_this_process(&usage);
+            state = (reporter->failures == 0 && reporter->exceptions == 0) ? WORKER_CLEAN : WORKER_DIRTY;
+            if (write(done, &state, 1) != 1)
+                return;
+            if (write(done, &usage, sizeof(usage)) != sizeof(usage))
+                return;
+            if (state == WORKER_DIRTY && worker->retire_when_dirty)
+                return;
+            break;
+        }
+    }
+}
+
+static FILE *take_content_of(FILE *worker_file) {
+    FILE *job_file = tmpfile();
+    char buffer[4096];
+    ssize_t length;
+    int fd = fileno(worker_file);
+
+    if (job_file == NULL) {
+        die("Could not create temporary files for worker process\n");
+    }
+    lseek(fd, 0, SEEK_SET);
+    while ((length = read(fd, buffer, sizeof(buffer))) > 0)
+        fwrite(buffer, 1, length, job_file);
+    fflush(job_file);
+    if (ftruncate(fd, 0) != 0) {
+        die("Could not reuse temporary files for worker process\n");
+    }
+    return job_file;
+}
+
+static void finish_worker_job(Worker *worker, int status) {
+    TestJob *job = worker->job;
+
+    job->status = status;
+    job->duration = cgreen_time_duration_in_nanoseconds(job->starting_time,
+                                                         cgreen_time_get_current_nanoseconds());
+    job->unsent_passes = take_unsent_passes(worker->pass_counter);
+    job->results = take_content_of(worker->results);
+    job->output = take_content_of(worker->output);
+    job->errors = take_content_of(worker->errors);
+    job->state = JOB_FINISHED;
+    worker->job = NULL;
+    cgreen_collector_forget(collector_of_this_run(), worker);
+}
+
+static void wait_for_any_worker(Worker *workers, int count) {
+    void *ready[READY_AT_A_TIME];
+    uint64_t deadline = 0;
+    uint64_t now;
+    int found = 0;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        if (workers[i].job != NULL && workers[i].job->deadline != 0
+            && (deadline == 0 || workers[i].job->deadline < deadline))
+            deadline = workers[i].job->deadline;
+    }
+
+    ignore_ctrl_c();
+    now = monotonic_milliseconds();
+    if (deadline == 0 || deadline > now)
+        found = cgreen_collector_wait(collector_of_this_run(), milliseconds_until(deadline),
+                                      ready, READY_AT_A_TIME);
+    allow_ctrl_c();
+
+    if (found == 0) {
+        /* A worker running past its deadline is replaced, as if it had crashed */
+        now = monotonic_milliseconds();
+        for (i = 0; i < count; i++) {
+            if (workers[i].job != NULL && workers[i].job->deadline != 0
+                && workers[i].job->deadline <= now) {
+                workers[i].job->timed_out = true;
+                finish_worker_job(&workers[i], kill_child_process(workers[i].pid, NULL));
+                workers[i].pid = 0;
+                stop_worker(&workers[i]);
+            }
+        }
+    }
+
+    for (i = 0; i < found; i++) {
+        Worker *worker = (Worker *)ready[i];
+        char state;
+
+        if (read(worker->done, &state, 1) == 1
+            && read_fully(worker->done, &worker->job->usage, sizeof(CgreenResourceUsage))) {
+            finish_worker_job(worker, 0);
+            if (state == WORKER_DIRTY && worker->retire_when_dirty)
+                stop_worker(worker);
+        } else {
+            /* The worker died in the middle of the test, what it used
+               is then mixed up with what earlier tests used */
+            int status = 0;
+            reap_child_process(worker->pid, 0, &status, NULL);
+            finish_worker_job(worker, status);
+            worker->pid = 0;
+            stop_worker(worker);
+        }
+    }
+}
+
+static void stop_worker(Worker *worker) {
+    cgreen_collector_forget(collector_of_this_run(), worker);
+    close(worker->control);
+    close(worker->done);
+    if (worker->pid != 0) {
+        int status;
+        ignore_ctrl_c();
+        waitpid(worker->pid, &status, 0);
+        allow_ctrl_c();
+    }
+    fclose(worker->results);
+    fclose(worker->output);
+    fclose(worker->errors);
+    unshare_pass_counters(worker->pass_counter, 1);
+    worker->pid = 0;
+}
+
+static pid_t fork_test_process(void) {
     fflush(NULL);               /* Flush all buffers before forking */
     pid_t child = fork();
     if (child < 0) {
         die("Could not fork process\n");
     }
-    return ! child;
+    return child;
 }
 
-static int wait_for_child_process(void) {
+/* Like waitpid() but also collects what the process used, if 'usage'
+   is given */
+static pid_t reap_child_process(pid_t child, int options, int *status, CgreenResourceUsage *usage) {
+    struct rusage rusage;
+    pid_t reaped;
+
+    while ((reaped = wait4(child, status, options, &rusage)) < 0 && errno == EINTR)
+        ;
+    if (reaped == child && usage != NULL)
+        resource_usage_between(usage, NULL, &rusage);
+    return reaped;
+}
+
+/* Only the test process holds the writing end of its exit pipe, so the
+   reading end can be polled for the process exiting, together with
+   others and with a timeout. It is not inherited over exec(), but if
+   the test forks a process that outlives it, the exit is not noticed
+   until the deadline. */
+static void create_exit_pipe(int exit_pipe[2]) {
+    if (pipe(exit_pipe) != 0) {
+        die("Could not create pipe for test process\n");
+    }
+    fcntl(exit_pipe[0], F_SETFD, FD_CLOEXEC);
+    fcntl(exit_pipe[1], F_SETFD, FD_CLOEXEC);
+}
+
+/* While the test runs its messages are drained whenever it has filled
+   the ring it sends them through, so that it can go on sending any
+   number of them. Without a timeout the process is also looked for
+   now and then, in case a process it forked holds on to the exit pipe. */
+#define EXIT_CHECK_INTERVAL_IN_MILLISECONDS 100
+
+static int wait_for_child_process_within(pid_t child, int exit_pipe, unsigned int timeout,
+                                         bool *timed_out, TestReporter *reporter) {
+    uint64_t deadline = timeout > 0 ? monotonic_milliseconds() + timeout : 0;
+    CgreenResourceUsage *usage = &reporter->resource_usage;
+    struct pollfd fds[2];
     int status = 0;
+    int polled;
+
+    fds[0].fd = exit_pipe;
+    fds[0].events = POLLIN;
+    fds[1].fd = get_cgreen_messaging_wakeup(reporter->ipc);
+    fds[1].events = POLLIN;
+
     ignore_ctrl_c();
-    wait(&status);
+    for (;;) {
+        int wait = milliseconds_until(deadline);
+
+        if (deadline != 0 && wait == 0) {
+            if (reap_child_process(child, WNOHANG, &status, usage) == child)
+                break;
+            status = kill_child_process(child, usage);
+            *timed_out = true;
+            break;
+        }
+        if (deadline == 0)
+            wait = EXIT_CHECK_INTERVAL_IN_MILLISECONDS;
+        polled = poll(fds, 2, wait);
+        if (polled > 0 && fds[1].revents != 0) {
+            clear_cgreen_messaging_wakeup(reporter->ipc);
+            drain_reporter_results(reporter);
+        }
+        if (polled > 0 && fds[0].revents != 0) {
+            reap_child_process(child, 0, &status, usage);
+            break;
+        }
+        if (polled == 0 && deadline == 0
+            && reap_child_process(child, WNOHANG, &status, usage) == child)
+            break;
+    }
     allow_ctrl_c();
+
     return status;
 }
 
+static int kill_child_process(pid_t child, CgreenResourceUsage *usage) {
+    int status = 0;
+
+    kill(child, SIGKILL);
+    reap_child_process(child, 0, &status, usage);
+    return status;
+}
+
+static uint64_t timeval_in_nanoseconds(struct timeval time) {
+    return (uint64_t)time.tv_sec * CGREEN_NANOSECONDS_PER_SECOND
+        + (uint64_t)time.tv_usec * (CGREEN_NANOSECONDS_PER_SECOND / 1000000);
+}
+
+/* Without 'before' the usage is that of a whole process. The maximum
+   resident set size is a high-water mark, so it is never a difference. */
+static void resource_usage_between(CgreenResourceUsage *usage, const struct rusage *before,
+                                   const struct rusage *after) {
+    struct rusage nothing_used;
+
+    if (before == NULL) {
+        memset(&nothing_used, 0, sizeof(nothing_used));
+        before = &nothing_used;
+    }
+    /* Allocations are counted by the test itself, and arrive with its
+       messages, possibly already drained while it ran */
+    CgreenAllocationUsage allocations = usage->allocations;
+
+    memset(usage, 0, sizeof(*usage));
+    usage->allocations = allocations;
+    usage->measured = 1;
+    usage->user_time = timeval_in_nanoseconds(after->ru_utime) - timeval_in_nanoseconds(before->ru_utime);
+    usage->system_time = timeval_in_nanoseconds(after->ru_stime) - timeval_in_nanoseconds(before->ru_stime);
+#ifdef __APPLE__
+    usage->max_resident_set_size = after->ru_maxrss / 1024;
+#else
+    usage->max_resident_set_size = after->ru_maxrss;
+#endif
+    usage->major_page_faults = after->ru_majflt - before->ru_majflt;
+    usage->minor_page_faults = after->ru_minflt - before->ru_minflt;
+    usage->voluntary_context_switches = after->ru_nvcsw - before->ru_nvcsw;
+    usage->involuntary_context_switches = after->ru_nivcsw - before->ru_nivcsw;
+}
+
+/* The counters are zero when shared, and only anonymous memory is
+   used so that nothing is left behind */
+static int *share_pass_counters(int count) {
+    int *counters = (int *) mmap(NULL, sizeof(int) * count, PROT_READ | PROT_WRITE,
+                                 MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (counters == MAP_FAILED) {
+        die("Could not share memory with test processes\n");
+    }
+    return counters;
+}
+
+static void unshare_pass_counters(int *counters, int count) {
+    munmap(counters, sizeof(int) * count);
+}
+
+/* Only once the test process is gone, so that it can't count any more */
+static int take_unsent_passes(int *counter) {
+    int passes = *counter;
+
+    *counter = 0;
+    return passes;
+}
+
+static uint64_t monotonic_milliseconds(void) {
+    return cgreen_time_get_current_nanoseconds() / CGREEN_NANOSECONDS_PER_MILLISECOND;
+}
+
+/* As a timeout for poll(), where no deadline means waiting forever */
+static int milliseconds_until(uint64_t deadline) {
+    uint64_t now = monotonic_milliseconds();
+
+    if (deadline == 0)
+        return -1;
+    if (deadline <= now)
+        return 0;
+    if (deadline - now > INT_MAX)
+        return INT_MAX;
+    return (int)(deadline - now);
+}
+
+/* Without a process of its own the test can't be watched from the
+   outside. Instead a timer signal reports the test as timed out and
+   stops the run, using only what is safe in a signal handler. */
+static char watchdog_message[512];
+static int watchdog_message_length;
+
+static void watchdog_expired(int signal_number) {
+    (void)signal_number;
+    if (write(STDERR_FILENO, watchdog_message, watchdog_message_length) < 0) {
+        /* Nothing more we can do */
+    }
+    _exit(EXIT_FAILURE);
+}
+
+void start_watchdog_in_this_process(CgreenTest *test, unsigned int timeout) {
+    struct itimerval timer;
+
+    watchdog_message_length = snprintf(watchdog_message, sizeof(watchdog_message),
+                                       "%s:%d: Exception: %s -> %s\n\tTest timed out after %u ms\n",
+                                       test->filename, test->line, test->context->name, test->name,
+                                       timeout);
+    if (watchdog_message_length >= (int)sizeof(watchdog_message))
+        watchdog_message_length = sizeof(watchdog_message) - 1;
+
+    fflush(NULL);
+    signal(SIGALRM, &watchdog_expired);
+    memset(&timer, 0, sizeof(timer));
+    timer.it_value.tv_sec = timeout / 1000;
+    timer.it_value.tv_usec = (timeout % 1000) * 1000;
+    setitimer(ITIMER_REAL, &timer, NULL);
+}
+
+void stop_watchdog_in_this_process(void) {
+    struct itimerval timer;
+
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_REAL, &timer, NULL);
+    signal(SIGALRM, SIG_DFL);
+}
+
+static struct rusage usage_at_start;
+
+void start_resource_measurement_in_this_process(void) {
+    getrusage(RUSAGE_SELF, &usage_at_start);
+}
+
+void finish_resource_measurement_in_this_process(CgreenResourceUsage *usage) {
+    struct rusage usage_at_finish;
+
+    getrusage(RUSAGE_SELF, &usage_at_finish);
+    resource_usage_between(usage, &usage_at_start, &usage_at_finish);
+}
+
 void die_in(unsigned int seconds) {
     sighandler_t signal_result = signal(SIGALRM, (sighandler_t)&stop);
     if (SIG_ERR == signal_result) {
@@ -1,14 +1,23 @@
 #include <cgreen/reporter.h>
 #include <cgreen/messaging.h>
 #include <cgreen/breadcrumb.h>
+#include <cgreen/vector.h>
+#include <cgreen/internal/cgreen_journal.h>
+#include <cgreen/internal/cgreen_lock.h>
+#include <cgreen/internal/cgreen_time.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
-enum { pass = 1, fail, skipped ,completion, exception };
+#include "utils.h"
+
+enum { pass = 1, fail, skipped ,completion, exception,
+       pass_shown, fail_shown, incomplete_shown, benchmark_shown, allocations_counted,
+       passes_counted, duration_measured };
 enum { FINISH_NOTIFICATION_RECEIVED = 0, FINISH_TEST_SKIPPED, FINISH_NOTIFICATION_NOT_RECEIVED };
 
 struct TestContext_ {
@@ -18,6 +27,28 @@ typedef struct TestContext_ TestContext;
 
 static TestContext context;
 
+/* When the test uses threads, what the other threads assert is kept
+   by each of them, and only shown by the thread of the test once it is
+   over, sorted on where the assertions were made. So nothing is sent
+   from the other threads, and what is shown is the same however the
+   threads happened to run. */
+typedef struct {
+    int result;
+    const char *file;
+    int line;
+    char *message;
+} KeptAssertion;
+
+static bool assertions_of_other_threads_are_kept = false;
+static int keeping = 0;
+static CgreenVector *kept_assertions_of_threads = NULL;
+static int kept_failures = 0;
+static CgreenLock *lock_of_kept_assertions = NULL;
+
+static CGREEN_THREAD_LOCAL bool is_thread_of_test = false;
+static CGREEN_THREAD_LOCAL CgreenVector *assertions_of_this_thread = NULL;
+static CGREEN_THREAD_LOCAL int keeping_of_this_thread = 0;
+
 static void show_pass(TestReporter *reporter, const char *file, int line,
                       const char *message, va_list arguments);
 static void show_skip(TestReporter *reporter, const char *file, int line);
@@ -25,9 +56,20 @@ static void show_fail(TestReporter *reporter, const char *file, int line,
                       const char *message, va_list arguments);
 static void show_incomplete(TestReporter *reporter, const char *file, int line,
                             const char *message, va_list arguments);
+static void show_benchmark(TestReporter *reporter, const char *file, int line,
+                           const CgreenBenchmarkStatistics *statistics);
+static void ignore_event(TestReporter *reporter, CgreenEvent *event);
 static void assert_true(TestReporter *reporter, const char *file, int line,
                         int result, const char *message, ...);
+static void record_pass(TestReporter *reporter, CgreenEvent *event);
+static void record_fail(TestReporter *reporter, CgreenEvent *event);
+static void record_incomplete(TestReporter *reporter, CgreenEvent *event);
+static void record_benchmark(TestReporter *reporter, const char *file, int line,
+                             const CgreenBenchmarkStatistics *statistics);
+static void replay_shown(TestReporter *reporter, int result, const char *payload, size_t size);
+static void keep_assertion(TestReporter *reporter, int result, CgreenEvent *event);
 static int  read_reporter_results(TestReporter *reporter);
+static void keep_durations_in_milliseconds(TestReporter *reporter);
 
 TestReporter *get_test_reporter() {
     return context.reporter;
@@ -35,6 +77,7 @@ TestReporter *get_test_reporter() {
 
 void setup_reporting(TestReporter *reporter) {
     reporter->ipc = start_cgreen_messaging(45);
+    drain_reporter_results_in_this_process(reporter);
     context.reporter = reporter;
 }
 
@@ -64,6 +107,10 @@ TestReporter *create_reporter() {
     reporter->show_skip = &show_skip;
     reporter->show_fail = &show_fail;
     reporter->show_incomplete = &show_incomplete;
+    reporter->show_benchmark = &show_benchmark;
+    reporter->report_pass = &ignore_event;
+    reporter->report_fail = &ignore_event;
+    reporter->report_incomplete = &ignore_event;
     reporter->assert_true = &assert_true;
     reporter->finish_test = &reporter_finish_test;
     reporter->finish_suite = &reporter_finish_suite;
@@ -77,9 +124,15 @@ TestReporter *create_reporter() {
     reporter->total_failures = 0;
     reporter->total_exceptions = 0;
     reporter->total_duration = 0;
+    reporter->duration_ns = 0;
+    reporter->total_duration_ns = 0;
     reporter->breadcrumb = breadcrumb;
     reporter->memo = NULL;
     reporter->options = NULL;
+    reporter->drained_status = FINISH_NOTIFICATION_NOT_RECEIVED;
+    reporter->summarize_passes = 1;
+    reporter->unsent_passes = 0;
+    reporter->shared_unsent_passes = NULL;
     return reporter;
 }
 
@@ -101,7 +154,30 @@ void destroy_memo(TestReportMemo *memo) {
     }
 }
 
+/* A test process doesn't show anything itself. Instead everything that
+   is to be shown is sent to the parent and shown from there, so that
+   the reporter gets all its calls in one process, and when tests are
+   run in parallel, in the order of the tests. This is irreversible and
+   only intended for the child process, where the counters then
+   instead count the failures and exceptions recorded. */
+void defer_reporter_output(TestReporter *reporter) {
+    reporter->failures = 0;
+    reporter->exceptions = 0;
+    if (!reporter->summarize_passes || reporter->show_pass != &show_pass
+        || reporter->report_pass != &ignore_event)
+        reporter->report_pass = &record_pass;
+    else
+        reporter->report_pass = &ignore_event;
+    reporter->report_fail = &record_fail;
+    reporter->report_incomplete = &record_incomplete;
+    reporter->show_pass = &show_pass;
+    reporter->show_fail = &show_fail;
+    reporter->show_incomplete = &show_incomplete;
+    reporter->show_benchmark = &record_benchmark;
+}
+
 void reporter_start_test(TestReporter *reporter, const char *name) {
+    memset(&reporter->resource_usage, 0, sizeof(reporter->resource_usage));
     push_breadcrumb((CgreenBreadcrumb *) reporter->breadcrumb, name);
 }
 
@@ -113,13 +189,21 @@ void reporter_start_suite(TestReporter *reporter, const char *name, const int co
 void reporter_finish_test(TestReporter *reporter, const char *filename, int line, const char *message) {
     int status = read_reporter_results(reporter);
 
+    keep_durations_in_milliseconds(reporter);
     if (status == FINISH_TEST_SKIPPED) {
+        journal_test_skipped(get_current_from_breadcrumb((CgreenBreadcrumb *)reporter->breadcrumb),
+                             filename, line);
         (*reporter->show_skip)(reporter, filename, line);
     } else if (status == FINISH_NOTIFICATION_NOT_RECEIVED) {
-        va_list no_arguments;
-        memset(&no_arguments, 0, sizeof(va_list));
+        CgreenEvent event;
+        memset(&event, 0, sizeof(event));
+        event.file = filename;
+        event.line = line;
+        event.message = message;
+        journal_test_not_finished(get_current_from_breadcrumb((CgreenBreadcrumb *)reporter->breadcrumb),
+                                  filename, line, message);
         reporter->exceptions++;
-        (*reporter->show_incomplete)(reporter, filename, line, message, no_arguments);
+        reporter_show_incomplete(reporter, &event);
     }
 
     pop_breadcrumb((CgreenBreadcrumb *)reporter->breadcrumb);
@@ -130,33 +214,310 @@ void reporter_finish_suite(TestReporter *reporter, const char *filename, int lin
     (void)line;
 
     read_reporter_results(reporter);
+    keep_durations_in_milliseconds(reporter);
     pop_breadcrumb((CgreenBreadcrumb *)reporter->breadcrumb);
 
 }
 
+/* Reporters built before the durations were measured in nanoseconds
+   still find them in milliseconds where they used to */
+static void keep_durations_in_milliseconds(TestReporter *reporter) {
+    reporter->duration = (uint32_t)(reporter->duration_ns / CGREEN_NANOSECONDS_PER_MILLISECOND);
+    reporter->total_duration = (uint32_t)(reporter->total_duration_ns / CGREEN_NANOSECONDS_PER_MILLISECOND);
+}
+
+static void show_formatted(void (*show)(TestReporter *, const char *, int, const char *, va_list),
+                           TestReporter *reporter, const char *file, int line,
+                           const char *format, ...) {
+    va_list arguments;
+    va_start(arguments, format);
+    (*show)(reporter, file, line, format, arguments);
+    va_end(arguments);
+}
+
+/* Reporters that override the show functions get the message and
+   its arguments, those that don't get the event */
+static void show_event(TestReporter *reporter, CgreenEvent *event,
+                       void (*show)(TestReporter *, const char *, int, const char *, va_list),
+                       void (*default_show)(TestReporter *, const char *, int, const char *, va_list),
+                       void (*report)(TestReporter *, CgreenEvent *)) {
+    if (show == default_show) {
+        (*report)(reporter, event);
+    } else if (event->format != NULL) {
+        va_list arguments;
+        va_copy(arguments, *event->arguments);
+        (*show)(reporter, event->file, event->line, event->format, arguments);
+        va_end(arguments);
+    } else if (event->message != NULL) {
+        show_formatted(show, reporter, event->file, event->line, "%s", event->message);
+    } else {
+        va_list no_arguments;
+        memset(&no_arguments, 0, sizeof(va_list));
+        (*show)(reporter, event->file, event->line, NULL, no_arguments);
+    }
+}
+
+static void show_assertion(TestReporter *reporter, int result, CgreenEvent *event) {
+    if (assertions_of_other_threads_are_kept && !is_thread_of_test) {
+        keep_assertion(reporter, result, event);
+        return;
+    }
+    journal_assertion(result, event);
+    if (result) {
+        show_event(reporter, event, reporter->show_pass, &show_pass, reporter->report_pass);
+    } else {
+        show_event(reporter, event, reporter->show_fail, &show_fail, reporter->report_fail);
+    }
+    add_reporter_result(reporter, result);
+    free(event->formatted);
+    event->formatted = NULL;
+}
+
+/* For assertions that know more than the message, which is formatted
+   from the format and the arguments only if it is needed */
+void reporter_show_assertion(TestReporter *reporter, int result, CgreenEvent *event,
+                             const char *format, ...) {
+    va_list arguments;
+
+    va_start(arguments, format);
+    event->format = format;
+    event->arguments = &arguments;
+    show_assertion(reporter, result, event);
+    va_end(arguments);
+}
+
+void reporter_show_incomplete(TestReporter *reporter, CgreenEvent *event) {
+    show_event(reporter, event, reporter->show_incomplete, &show_incomplete, reporter->report_incomplete);
+    free(event->formatted);
+    event->formatted = NULL;
+}
+
+/* Made from the thread of the test, before it starts any other */
+void keep_assertions_of_other_threads(void) {
+    if (lock_of_kept_assertions == NULL)
+        lock_of_kept_assertions = cgreen_lock_create();
+    if (kept_assertions_of_threads == NULL)
+        kept_assertions_of_threads = create_cgreen_vector((GenericDestructor)&destroy_cgreen_vector);
+    /* A thread that outlives a test gets a new vector in the next */
+    keeping++;
+    is_thread_of_test = true;
+    assertions_of_other_threads_are_kept = true;
+}
+
+static void destroy_kept_assertion(KeptAssertion *kept) {
+    free(kept->message);
+    free(kept);
+}
+
+/* The failures are counted at once, since mocks look at the count to
+   tell if their constraints failed */
+static void keep_assertion(TestReporter *reporter, int result, CgreenEvent *event) {
+    KeptAssertion *kept = (KeptAssertion *)malloc(sizeof(KeptAssertion));
+    const char *message = cgreen_event_message(event);
+
+    kept->result = result;
+    kept->file = event->file;
+    kept->line = event->line;
+    kept->message = message != NULL ? string_dup(message) : NULL;
+    free(event->formatted);
+    event->formatted = NULL;
+
+    if (assertions_of_this_thread == NULL || keeping_of_this_thread != keeping) {
+        assertions_of_this_thread = create_cgreen_vector((GenericDestructor)&destroy_kept_assertion);
+        keeping_of_this_thread = keeping;
+        cgreen_lock_take(lock_of_kept_assertions);
+        cgreen_vector_add(kept_assertions_of_threads, assertions_of_this_thread);
+        cgreen_lock_release(lock_of_kept_assertions);
+    }
+    cgreen_vector_add(assertions_of_this_thread, kept);
+
+    if (!result) {
+        cgreen_lock_take(lock_of_kept_assertions);
+        reporter->failures++;
+        kept_failures++;
+        cgreen_lock_release(lock_of_kept_assertions);
+    }
+}
+
+static int compare_kept_assertions(const void *first, const void *second) {
+    const KeptAssertion *a = *(const KeptAssertion * const *)first;
+    const KeptAssertion *b = *(const KeptAssertion * const *)second;
+    int difference = strcmp(a->file, b->file);
+
+    if (difference != 0)
+        return difference;
+    if (a->line != b->line)
+        return a->line < b->line ? -1 : 1;
+    if (a->result != b->result)
+        return a->result < b->result ? -1 : 1;
+    if (a->message == NULL || b->message == NULL)
+        return (a->message != NULL) - (b->message != NULL);
+    return strcmp(a->message, b->message);
+}
+
+/* Once the other threads are done. The failures they counted are
+   counted again as they are shown. */
+void show_assertions_of_other_threads(TestReporter *reporter) {
+    KeptAssertion **all;
+    int count = 0;
+    int t, i;
+
+    if (!assertions_of_other_threads_are_kept)
+        return;
+    assertions_of_other_threads_are_kept = false;
+    reporter->failures -= kept_failures;
+    kept_failures = 0;
+
+    for (t = 0; t < cgreen_vector_size(kept_assertions_of_threads); t++)
+        count += cgreen_vector_size((CgreenVector *)cgreen_vector_get(kept_assertions_of_threads, t));
+    all = (KeptAssertion **)malloc((count > 0 ? count : 1) * sizeof(KeptAssertion *));
+    count = 0;
+    for (t = 0; t < cgreen_vector_size(kept_assertions_of_threads); t++) {
+        CgreenVector *assertions = (CgreenVector *)cgreen_vector_get(kept_assertions_of_threads, t);
+        for (i = 0; i < cgreen_vector_size(assertions); i++)
+            all[count++] = (KeptAssertion *)cgreen_vector_get(assertions, i);
+    }
+    qsort(all, (size_t)count, sizeof(KeptAssertion *), &compare_kept_assertions);
+
+    for (i = 0; i < count; i++) {
+        CgreenEvent event;
+
+        memset(&event, 0, sizeof(event));
+        event.file = all[i]->file;
+        event.line = all[i]->line;
+        event.message = all[i]->message;
+        show_assertion(reporter, all[i]->result, &event);
+    }
+
+    free(all);
+    destroy_cgreen_vector(kept_assertions_of_threads);
+    kept_assertions_of_threads = NULL;
+}
+
+/* A message that can't be formatted is missing */
+const char *cgreen_event_message(CgreenEvent *event) {
+    va_list arguments;
+    int length;
+
+    if (event->message != NULL || event->format == NULL)
+        return event->message;
+
+    va_copy(arguments, *event->arguments);
+    length = vsnprintf(NULL, 0, event->format, arguments);
+    va_end(arguments);
+    if (length < 0 || (event->formatted = (char *) malloc((size_t)length + 1)) == NULL)
+        return NULL;
+    va_copy(arguments, *event->arguments);
+    vsnprintf(event->formatted, (size_t)length + 1, event->format, arguments);
+    va_end(arguments);
+    event->message = event->formatted;
+    return event->message;
+}
+
+/* Read what the test has sent so far, while it is still running, so
+   that it does not have to wait for room to send more */
+void drain_reporter_results(TestReporter *reporter) {
+    if (reporter->drained_status == FINISH_NOTIFICATION_NOT_RECEIVED)
+        reporter->drained_status = read_reporter_results(reporter);
+}
+
+static void drain_results_of(void *reporter) {
+    drain_reporter_results((TestReporter *)reporter);
+}
+
+/* What is sent from the process that reads it, when tests are not run
+   in processes of their own or from the BeforeAll of a context, is
+   read as soon as there is no more room for it */
+void drain_reporter_results_in_this_process(TestReporter *reporter) {
+    drain_cgreen_messaging_with(reporter->ipc, &drain_results_of, reporter);
+}
+
+static int *unsent_passes_of(TestReporter *reporter) {
+    return reporter->shared_unsent_passes != NULL ? reporter->shared_unsent_passes : &reporter->unsent_passes;
+}
+
+/* Passes are only counted, and the count is sent before anything else
+   is, so that the messages stay in order. Reporters that want to know
+   about every pass as it happens don't summarize them. */
 void add_reporter_result(TestReporter *reporter, int result) {
+    if (result && reporter->summarize_passes) {
+        (*unsent_passes_of(reporter))++;
+        return;
+    }
+    flush_reporter_results(reporter);
     send_cgreen_message(reporter->ipc, result ? pass : fail);
 }
 
+/* The count is cleared before it is sent, so that if the test dies
+   while sending it the passes are rather missed than counted twice */
+void flush_reporter_results(TestReporter *reporter) {
+    int *unsent_passes = unsent_passes_of(reporter);
+    int passes = *unsent_passes;
+
+    if (passes == 0)
+        return;
+    *unsent_passes = 0;
+    send_cgreen_message_with_payload(reporter->ipc, passes_counted, &passes, sizeof(passes));
+}
+
+/* A test process counts the passes it has not yet sent in memory that
+   it shares with the parent, which can then count those that the test
+   never got to send because it crashed, was killed or exited */
+void count_unsent_passes_in(TestReporter *reporter, int *counter) {
+    *counter = reporter->unsent_passes;
+    reporter->unsent_passes = 0;
+    reporter->shared_unsent_passes = counter;
+}
+
 void send_reporter_exception_notification(TestReporter *reporter) {
+    flush_reporter_results(reporter);
     send_cgreen_message(reporter->ipc, exception);
 }
 
 void send_reporter_skipped_notification(TestReporter *reporter) {
+    flush_reporter_results(reporter);
     send_cgreen_message(reporter->ipc, skipped);
 }
 
 void send_reporter_completion_notification(TestReporter *reporter) {
+    flush_reporter_results(reporter);
     send_cgreen_message(reporter->ipc, completion);
 }
 
+/* How long the test itself took, which is what is reported rather
+   than how long it took to run it in a process of its own */
+void send_reporter_duration(TestReporter *reporter, uint64_t duration) {
+    send_cgreen_message_with_payload(reporter->ipc, duration_measured, &duration, sizeof(duration));
+}
+
+void send_reporter_allocation_usage(TestReporter *reporter, const CgreenAllocationUsage *usage) {
+    flush_reporter_results(reporter);
+    send_cgreen_message_with_payload(reporter->ipc, allocations_counted, usage, sizeof(CgreenAllocationUsage));
+}
+
+static void show_as_event(TestReporter *reporter, const char *file, int line,
+                          const char *message, va_list arguments,
+                          void (*report)(TestReporter *, CgreenEvent *)) {
+    CgreenEvent event;
+    va_list copy;
+
+    memset(&event, 0, sizeof(event));
+    event.file = file;
+    event.line = line;
+    if (message != NULL) {
+        va_copy(copy, arguments);
+        event.format = message;
+        event.arguments = &copy;
+    }
+    (*report)(reporter, &event);
+    if (message != NULL)
+        va_end(copy);
+    free(event.formatted);
+}
+
 static void show_pass(TestReporter *reporter, const char *file, int line,
                       const char *message, va_list arguments) {
-    (void)reporter;
-    (void)file;
-    (void)line;
-    (void)message;
-    (void)arguments;
+    show_as_event(reporter, file, line, message, arguments, reporter->report_pass);
 }
 
 static void show_skip(TestReporter *reporter, const char *file, int line) {
@@ -167,41 +528,196 @@ static void show_skip(TestReporter *reporter, const char *file, int line) {
 
 static void show_fail(TestReporter *reporter, const char *file, int line,
                       const char *message, va_list arguments) {
-    (void)reporter;
-    (void)file;
-    (void)line;
-    (void)message;
-    (void)arguments;
+    show_as_event(reporter, file, line, message, arguments, reporter->report_fail);
 }
 
 static void show_incomplete(TestReporter *reporter, const char *file, int line,
                             const char *message, va_list arguments) {
+    show_as_event(reporter, file, line, message, arguments, reporter->report_incomplete);
+}
+
+static void show_benchmark(TestReporter *reporter, const char *file, int line,
+                           const CgreenBenchmarkStatistics *statistics) {
     (void)reporter;
     (void)file;
     (void)line;
-    (void)message;
-    (void)arguments;
+    (void)statistics;
+}
+
+static void ignore_event(TestReporter *reporter, CgreenEvent *event) {
+    (void)reporter;
+    (void)event;
 }
 
 static void assert_true(TestReporter *reporter, const char *file, int line,
                         int result, const char *message, ...) {
+    CgreenEvent event;
     va_list arguments;
-    memset(&arguments, 0, sizeof(va_list));
 
     va_start(arguments, message);
-    if (result) {
-            (*reporter->show_pass)(reporter, file, line, message, arguments);
+    memset(&event, 0, sizeof(event));
+    event.file = file;
+    event.line = line;
+    event.format = message;
+    event.arguments = &arguments;
+    show_assertion(reporter, result, &event);
+    va_end(arguments);
+}
+
+/* Everything that is to be shown is sent as a record, followed by the
+   file name and then the formatted message or the benchmark
+   statistics, so that the parent can make the same call to the
+   reporter. The lengths include the terminating zero of the strings,
+   and a message of zero length is a missing message, since the
+   reporters treat NULL messages specially. */
+typedef struct {
+    int line;
+    uint32_t file_length;
+    uint32_t content_length;
+} ShownRecord;
+
+static void send_shown(TestReporter *reporter, int result, const char *file, int line,
+                       const void *content, size_t content_length) {
+    char small_payload[1024];
+    ShownRecord record;
+    size_t size;
+    char *payload;
+
+    record.line = line;
+    record.file_length = (uint32_t)strlen(file) + 1;
+    record.content_length = (uint32_t)content_length;
+
+    size = sizeof(record) + record.file_length + record.content_length;
+    if (size <= sizeof(small_payload))
+        payload = small_payload;
+    else
+        payload = (char *) malloc(size);
+    if (payload == NULL) {
+        return;
+    }
+    memcpy(payload, &record, sizeof(record));
+    memcpy(payload + sizeof(record), file, record.file_length);
+    memcpy(payload + sizeof(record) + record.file_length, content, record.content_length);
+
+    flush_reporter_results(reporter);
+    send_cgreen_message_with_payload(reporter->ipc, result, payload, size);
+    if (payload != small_payload)
+        free(payload);
+    if (result != pass_shown)
+        notify_cgreen_messaging_reader(reporter->ipc);
+}
+
+static void record_shown(TestReporter *reporter, int result, CgreenEvent *event) {
+    const char *message = cgreen_event_message(event);
+
+    send_shown(reporter, result, event->file, event->line, message,
+               message != NULL ? strlen(message) + 1 : 0);
+}
+
+static void record_pass(TestReporter *reporter, CgreenEvent *event) {
+    record_shown(reporter, pass_shown, event);
+}
+
+/* The thread of the test counts under the same lock as the other
+   threads of it, see keep_assertion() */
+static void count_in_thread_of_test(int *count) {
+    bool locked = assertions_of_other_threads_are_kept;
+
+    if (locked)
+        cgreen_lock_take(lock_of_kept_assertions);
+    (*count)++;
+    if (locked)
+        cgreen_lock_release(lock_of_kept_assertions);
+}
+
+static void record_fail(TestReporter *reporter, CgreenEvent *event) {
+    count_in_thread_of_test(&reporter->failures);
+    record_shown(reporter, fail_shown, event);
+}
+
+static void record_incomplete(TestReporter *reporter, CgreenEvent *event) {
+    count_in_thread_of_test(&reporter->exceptions);
+    record_shown(reporter, incomplete_shown, event);
+}
+
+static void record_benchmark(TestReporter *reporter, const char *file, int line,
+                             const CgreenBenchmarkStatistics *statistics) {
+    send_shown(reporter, benchmark_shown, file, line, statistics, sizeof(CgreenBenchmarkStatistics));
+}
+
+/* A record that doesn't add up, e.g. from a test that crashed while
+   sending it, is ignored */
+static void replay_shown(TestReporter *reporter, int result, const char *payload, size_t size) {
+    CgreenEvent event;
+    ShownRecord record;
+    const char *file;
+    const char *content;
+
+    if (size < sizeof(record))
+        return;
+    memcpy(&record, payload, sizeof(record));
+    if (record.file_length == 0
+        || sizeof(record) + (size_t)record.file_length + record.content_length != size)
+        return;
+    file = payload + sizeof(record);
+    content = file + record.file_length;
+    if (file[record.file_length - 1] != '\0')
+        return;
+
+    if (result == benchmark_shown) {
+        CgreenBenchmarkStatistics statistics;
+        if (record.content_length != sizeof(statistics))
+            return;
+        memcpy(&statistics, content, sizeof(statistics));
+        (*reporter->show_benchmark)(reporter, file, record.line, &statistics);
+        return;
+    }
+    if (record.content_length > 0 && content[record.content_length - 1] != '\0')
+        return;
+
+    memset(&event, 0, sizeof(event));
+    event.file = file;
+    event.line = record.line;
+    event.message = record.content_length > 0 ? content : NULL;
+    if (result == pass_shown) {
+        show_event(reporter, &event, reporter->show_pass, &show_pass, reporter->report_pass);
+    } else if (result == fail_shown) {
+        show_event(reporter, &event, reporter->show_fail, &show_fail, reporter->report_fail);
     } else {
-            (*reporter->show_fail)(reporter, file, line, message, arguments);
+        reporter_show_incomplete(reporter, &event);
     }
+}
 
-    add_reporter_result(reporter, result);
-    va_end(arguments);
+static void read_payload(TestReporter *reporter, int result, const char *payload, size_t size) {
+    if (result == allocations_counted && size == sizeof(CgreenAllocationUsage)) {
+        memcpy(&reporter->resource_usage.allocations, payload, size);
+    } else if (result == passes_counted && size == sizeof(int)) {
+        int passes;
+        memcpy(&passes, payload, size);
+        reporter->passes += passes;
+    } else if (result == duration_measured && size == sizeof(uint64_t)) {
+        memcpy(&reporter->duration_ns, payload, size);
+    } else {
+        replay_shown(reporter, result, payload, size);
+    }
 }
 
 static int read_reporter_results(TestReporter *reporter) {
     int result;
-    while ((result = receive_cgreen_message(reporter->ipc)) > 0) {
+    void *payload;
+    size_t size;
+
+    if (reporter->drained_status != FINISH_NOTIFICATION_NOT_RECEIVED) {
+        result = reporter->drained_status;
+        reporter->drained_status = FINISH_NOTIFICATION_NOT_RECEIVED;
+        return result;
+    }
+    while ((result = receive_cgreen_message_with_payload(reporter->ipc, &payload, &size)) > 0) {
+        if (payload != NULL) {
+            read_payload(reporter, result, (const char *)payload, size);
+            free(payload);
+            continue;
+        }
         if (result == pass) {
             reporter->passes++;
         } else if (result == skipped) {
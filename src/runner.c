@@ -1,16 +1,20 @@
 #include <cgreen/assertions.h>
+#include <cgreen/message_formatting.h>
 #include <cgreen/mocks.h>
 #include <cgreen/reporter.h>
 #include <cgreen/suite.h>
 #include <cgreen/internal/runner_platform.h>
+#include <limits.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <cgreen/internal/cgreen_journal.h>
 #include <cgreen/internal/cgreen_time.h>
 
+#include "constraint_internal.h"
 #include "runner.h"
 
 #ifdef __ANDROID__
@@ -19,34 +23,59 @@
 
 
 static const char* CGREEN_PER_TEST_TIMEOUT_ENVIRONMENT_VARIABLE = "CGREEN_PER_TEST_TIMEOUT";
+static const char* CGREEN_JOBS_ENVIRONMENT_VARIABLE = "CGREEN_JOBS";
+static const char* CGREEN_REUSE_PROCESSES_ENVIRONMENT_VARIABLE = "CGREEN_REUSE_PROCESSES";
+static const char* CGREEN_ISOLATION_ENVIRONMENT_VARIABLE = "CGREEN_ISOLATION";
+
+static int parallel_jobs = 1;
+static CgreenIsolation requested_isolation = isolate_tests;
+static bool isolation_was_requested = false;
+static CgreenIsolation isolation = isolate_tests;
+static unsigned int default_timeout = 0;
 
 static void run_every_test(TestSuite *suite, TestReporter *reporter);
+static void run_tests_of(TestSuite *suite, TestReporter *reporter);
 static void run_named_test(TestSuite *suite, const char *name, TestReporter *reporter);
 
 static void run_test_in_the_current_process(TestSuite *suite, CgreenTest *test, TestReporter *reporter);
 
-static int per_test_timeout_defined(void);
-static int per_test_timeout_value(void);
-static void validate_per_test_timeout_value(void);
+static unsigned int timeout_from_environment(void);
+static int jobs_from_environment(void);
+static CgreenIsolation isolation_from_environment(void);
+static void run_setup_in_main_process(void (*setup)(void));
+static void run_teardown_in_main_process(void (*teardown)(void));
 
 int run_test_suite(TestSuite *suite, TestReporter *reporter) {
+    return run_test_suite_parallel(suite, reporter, jobs_from_environment());
+}
+
+int run_test_suite_parallel(TestSuite *suite, TestReporter *reporter, int jobs) {
     int success;
-    if (per_test_timeout_defined()) {
-        validate_per_test_timeout_value();
-    }
 
+    default_timeout = timeout_from_environment();
+    parallel_jobs = jobs > 1 ? jobs : 1;
+    isolation = isolation_from_environment();
+    start_journal_if_requested();
     setup_reporting(reporter);
     run_every_test(suite, reporter);
+    if (isolation == isolate_library) {
+        stop_library_worker();
+    }
+    parallel_jobs = 1;
     success = (reporter->total_failures == 0) && (reporter->total_exceptions==0);
     return success ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
+void set_test_isolation(CgreenIsolation level) {
+    requested_isolation = level;
+    isolation_was_requested = true;
+}
+
 int run_single_test(TestSuite *suite, const char *name, TestReporter *reporter) {
     int success;
-    if (per_test_timeout_defined()) {
-        validate_per_test_timeout_value();
-    }
 
+    default_timeout = timeout_from_environment();
+    start_journal_if_requested();
     setup_reporting(reporter);
     run_named_test(suite, name, reporter);
     success = (reporter->total_failures == 0);
@@ -58,15 +87,15 @@ static void run_every_test(TestSuite *suite, TestReporter *reporter) {
 
     run_specified_test_if_child(suite, reporter);
 
-    uint32_t total_test_starting_milliseconds = cgreen_time_get_current_milliseconds();
+    uint64_t total_test_starting_time = cgreen_time_get_current_nanoseconds();
     (*reporter->start_suite)(reporter, suite->name, count_tests(suite));
 
     // Run sub-suites first
     for (i = 0; i < suite->size; i++) {
         if (suite->tests[i].type != test_function) {
-            (*suite->setup)();
+            run_setup_in_main_process(suite->setup);
             run_every_test(suite->tests[i].Runnable.suite, reporter);
-            (*suite->teardown)();
+            run_teardown_in_main_process(suite->teardown);
         }
     }
 
@@ -76,30 +105,80 @@ static void run_every_test(TestSuite *suite, TestReporter *reporter) {
     reporter->skips = 0;
     reporter->exceptions = 0;
 
-    uint32_t test_starting_milliseconds = cgreen_time_get_current_milliseconds();
+    uint64_t test_starting_time = cgreen_time_get_current_nanoseconds();
 
-    // Run top-level tests
-    for (i = 0; i < suite->size; i++) {
-        if (suite->tests[i].type == test_function) {
-            if (getenv("CGREEN_NO_FORK") == NULL)
-                run_test_in_its_own_process(suite, suite->tests[i].Runnable.test, reporter);
-            else
-                run_test_in_the_current_process(suite, suite->tests[i].Runnable.test, reporter);
-        }
-    }
+    run_setup_in_main_process(suite->before_all);
+    run_tests_of(suite, reporter);
+    run_teardown_in_main_process(suite->after_all);
 
-    reporter->duration = cgreen_time_duration_in_milliseconds(test_starting_milliseconds,
-                                                                  cgreen_time_get_current_milliseconds());
-    reporter->total_duration = cgreen_time_duration_in_milliseconds(total_test_starting_milliseconds,
-                                                                  cgreen_time_get_current_milliseconds());
+    reporter->duration_ns = cgreen_time_duration_in_nanoseconds(test_starting_time,
+                                                                  cgreen_time_get_current_nanoseconds());
+    reporter->total_duration_ns = cgreen_time_duration_in_nanoseconds(total_test_starting_time,
+                                                                  cgreen_time_get_current_nanoseconds());
     send_reporter_completion_notification(reporter);
     (*reporter->finish_suite)(reporter, suite->filename, suite->line);
 }
 
+/* Setup and teardown that are run outside of the tests, so that the
+   test processes inherit their effects. Except when all tests run in
+   the same process, then that process has to run them instead. */
+static void run_setup_in_main_process(void (*setup)(void)) {
+    if (isolation == isolate_library && getenv("CGREEN_NO_FORK") == NULL)
+        run_setup_in_library_worker(setup);
+    else
+        (*setup)();
+}
+
+static void run_teardown_in_main_process(void (*teardown)(void)) {
+    if (isolation == isolate_library && getenv("CGREEN_NO_FORK") == NULL)
+        run_teardown_in_library_worker(teardown);
+    else
+        (*teardown)();
+}
+
+static void run_tests_of(TestSuite *suite, TestReporter *reporter) {
+    CgreenTest **tests;
+    int count = 0;
+    int i;
+
+    if (getenv("CGREEN_NO_FORK") != NULL) {
+        for (i = 0; i < suite->size; i++)
+            if (suite->tests[i].type == test_function)
+                run_test_in_the_current_process(suite, suite->tests[i].Runnable.test, reporter);
+        return;
+    }
+
+    if (isolation == isolate_tests && parallel_jobs == 1
+        && getenv(CGREEN_REUSE_PROCESSES_ENVIRONMENT_VARIABLE) == NULL) {
+        for (i = 0; i < suite->size; i++)
+            if (suite->tests[i].type == test_function)
+                run_test_in_its_own_process(suite, suite->tests[i].Runnable.test, reporter);
+        return;
+    }
+
+    tests = (CgreenTest **) malloc(sizeof(CgreenTest *) * (suite->size + 1));
+    if (tests == NULL) {
+        die("Could not allocate memory for parallel test run\n");
+    }
+    for (i = 0; i < suite->size; i++)
+        if (suite->tests[i].type == test_function)
+            tests[count++] = suite->tests[i].Runnable.test;
+
+    if (isolation == isolate_library)
+        run_tests_in_library_worker(suite, tests, count, reporter);
+    else if (isolation == isolate_contexts)
+        run_tests_in_worker_pool(suite, tests, count, reporter, parallel_jobs, false);
+    else if (getenv(CGREEN_REUSE_PROCESSES_ENVIRONMENT_VARIABLE) != NULL)
+        run_tests_in_worker_pool(suite, tests, count, reporter, parallel_jobs, true);
+    else
+        run_tests_in_parallel_processes(suite, tests, count, reporter, parallel_jobs);
+    free(tests);
+}
+
 static void run_named_test(TestSuite *suite, const char *name, TestReporter *reporter) {
     int i;
 
-    uint32_t total_test_starting_milliseconds = cgreen_time_get_current_milliseconds();
+    uint64_t total_test_starting_time = cgreen_time_get_current_nanoseconds();
 
     (*reporter->start_suite)(reporter, suite->name, count_tests(suite));
     for (i = 0; i < suite->size; i++) {
@@ -117,20 +196,22 @@ static void run_named_test(TestSuite *suite, const char *name, TestReporter *rep
     reporter->skips = 0;
     reporter->exceptions = 0;
 
-    uint32_t test_starting_milliseconds = cgreen_time_get_current_milliseconds();
+    uint64_t test_starting_time = cgreen_time_get_current_nanoseconds();
 
     for (i = 0; i < suite->size; i++) {
         if (suite->tests[i].type == test_function) {
             if (strcmp(suite->tests[i].name, name) == 0) {
+                (*suite->before_all)();
                 run_test_in_the_current_process(suite, suite->tests[i].Runnable.test, reporter);
+                (*suite->after_all)();
             }
         }
     }
 
-    reporter->duration = cgreen_time_duration_in_milliseconds(test_starting_milliseconds,
-                                                                  cgreen_time_get_current_milliseconds());
-    reporter->total_duration = cgreen_time_duration_in_milliseconds(total_test_starting_milliseconds,
-                                                                  cgreen_time_get_current_milliseconds());
+    reporter->duration_ns = cgreen_time_duration_in_nanoseconds(test_starting_time,
+                                                                  cgreen_time_get_current_nanoseconds());
+    reporter->total_duration_ns = cgreen_time_duration_in_nanoseconds(total_test_starting_time,
+                                                                  cgreen_time_get_current_nanoseconds());
 
     send_reporter_completion_notification(reporter);
     (*reporter->finish_suite)(reporter, suite->filename, suite->line);
@@ -138,45 +219,83 @@ static void run_named_test(TestSuite *suite, const char *name, TestReporter *rep
 
 
 static void run_test_in_the_current_process(TestSuite *suite, CgreenTest *test, TestReporter *reporter) {
-    uint32_t test_starting_milliseconds = cgreen_time_get_current_milliseconds();
+    uint64_t test_starting_time = cgreen_time_get_current_nanoseconds();
 
     (*reporter->start_test)(reporter, test->name);
     if (test->skip) {
         send_reporter_skipped_notification(reporter);
     } else {
+        unsigned int timeout = timeout_for(suite, test);
+
+        /* Nothing can watch the test from the outside, but it can at
+           least be stopped, and reported, before it hangs the run */
+        if (timeout > 0)
+            start_watchdog_in_this_process(test, timeout);
+        reporter->duration_ns = 0;
+        start_resource_measurement_in_this_process();
         run_the_test_code(suite, test, reporter);
-        reporter->duration = cgreen_time_duration_in_milliseconds(test_starting_milliseconds,
-                                                             cgreen_time_get_current_milliseconds());
+        finish_resource_measurement_in_this_process(&reporter->resource_usage);
+        if (timeout > 0)
+            stop_watchdog_in_this_process();
+        /* Replaced by how long the test itself took when that is read,
+           unless it already has been */
+        if (reporter->duration_ns == 0)
+            reporter->duration_ns = cgreen_time_duration_in_nanoseconds(test_starting_time,
+                                                                        cgreen_time_get_current_nanoseconds());
 
         send_reporter_completion_notification(reporter);
     }
     (*reporter->finish_test)(reporter, test->filename, test->line, NULL);
 }
 
-static int per_test_timeout_defined() {
-    return getenv(CGREEN_PER_TEST_TIMEOUT_ENVIRONMENT_VARIABLE) != NULL;
-}
+static int jobs_from_environment(void) {
+    const char *jobs_string = getenv(CGREEN_JOBS_ENVIRONMENT_VARIABLE);
+    int jobs;
 
-static int per_test_timeout_value() {
-    char* timeout_string;
-    int timeout_value;
+    if (jobs_string == NULL) {
+        return 1;
+    }
 
-    if (!per_test_timeout_defined()) {
-        die("attempt to fetch undefined value for %s\n", CGREEN_PER_TEST_TIMEOUT_ENVIRONMENT_VARIABLE);
+    jobs = atoi(jobs_string);
+    if (jobs <= 0) {
+        die("invalid value for %s environment variable: %s\n", CGREEN_JOBS_ENVIRONMENT_VARIABLE, jobs_string);
     }
 
-    timeout_string = getenv(CGREEN_PER_TEST_TIMEOUT_ENVIRONMENT_VARIABLE);
-    timeout_value = atoi(timeout_string);
+    return jobs;
+}
+
+/* Only if no level was asked for, like the jobs of the runner */
+static CgreenIsolation isolation_from_environment(void) {
+    const char *level = getenv(CGREEN_ISOLATION_ENVIRONMENT_VARIABLE);
+
+    if (level == NULL || isolation_was_requested) {
+        return requested_isolation;
+    } else if (strcmp(level, "test") == 0) {
+        return isolate_tests;
+    } else if (strcmp(level, "context") == 0) {
+        return isolate_contexts;
+    } else if (strcmp(level, "library") == 0) {
+        return isolate_library;
+    }
 
-    return timeout_value;
+    die("invalid value for %s environment variable: %s (use test, context or library)\n",
+        CGREEN_ISOLATION_ENVIRONMENT_VARIABLE, level);
+    return isolate_tests;
 }
 
-static void validate_per_test_timeout_value() {
-    int timeout = per_test_timeout_value();
+/* The timeout is in seconds, or in milliseconds if it ends with "ms" */
+static unsigned int timeout_from_environment(void) {
+    return cgreen_time_milliseconds_from_environment(CGREEN_PER_TEST_TIMEOUT_ENVIRONMENT_VARIABLE);
+}
 
-    if (timeout <= 0) {
-        die("invalid value for %s environment variable: %d\n", CGREEN_PER_TEST_TIMEOUT_ENVIRONMENT_VARIABLE, timeout);
-    }
+/* A timeout for the test itself overrides the one for its suite, or
+   context, which overrides the one from the environment */
+unsigned int timeout_for(TestSuite *suite, CgreenTest *test) {
+    if (test->timeout > 0)
+        return test->timeout;
+    if (suite->timeout > 0)
+        return suite->timeout;
+    return default_timeout;
 }
 
 static void run_setup_for(CgreenTest *spec) {
@@ -210,10 +329,13 @@ static void run_setup_for(CgreenTest *spec) {
     } catch (...) {
         message += "unknown exception type";
     }
-    va_list no_arguments;
-    memset(&no_arguments, 0, sizeof(va_list));
+    CgreenEvent event;
+    memset(&event, 0, sizeof(event));
+    event.file = spec->filename;
+    event.line = spec->line;
+    event.message = message.c_str();
     TestReporter *reporter = get_test_reporter();
-    reporter->show_incomplete(reporter, spec->filename, spec->line, message.c_str(), no_arguments);
+    reporter_show_incomplete(reporter, &event);
     send_reporter_exception_notification(reporter);
 #endif
 }
@@ -249,10 +371,13 @@ static void run_teardown_for(CgreenTest *spec) {
     } catch (...) {
         message += "unknown exception type";
     }
-    va_list no_arguments;
-    memset(&no_arguments, 0, sizeof(va_list));
+    CgreenEvent event;
+    memset(&event, 0, sizeof(event));
+    event.file = spec->filename;
+    event.line = spec->line;
+    event.message = message.c_str();
     TestReporter *reporter = get_test_reporter();
-    reporter->show_incomplete(reporter, spec->filename, spec->line, message.c_str(), no_arguments);
+    reporter_show_incomplete(reporter, &event);
     send_reporter_exception_notification(reporter);
 #endif
 }
@@ -295,23 +420,27 @@ static void run(CgreenTest *spec) {
     } catch (...) {
         message += "unknown exception type";
     }
-    va_list no_arguments;
-    memset(&no_arguments, 0, sizeof(va_list));
+    CgreenEvent event;
+    memset(&event, 0, sizeof(event));
+    event.file = spec->filename;
+    event.line = spec->line;
+    event.message = message.c_str();
     TestReporter *reporter = get_test_reporter();
-    reporter->show_incomplete(reporter, spec->filename, spec->line, message.c_str(), no_arguments);
+    reporter_show_incomplete(reporter, &event);
     send_reporter_exception_notification(reporter);
 #endif
 }
 
 void run_the_test_code(TestSuite *suite, CgreenTest *spec, TestReporter *reporter) {
+    uint64_t test_starting_time = cgreen_time_get_current_nanoseconds();
+    uint64_t duration;
+
+    journal_test_started(spec->name, spec->filename, spec->line);
     significant_figures_for_assert_double_are(8);
     clear_mocks();
-
-    if (per_test_timeout_defined()) {
-        validate_per_test_timeout_value();
-
-        die_in(per_test_timeout_value());
-    }
+    forget_failure_messages_of_this_test();
+    forget_storage_for_next_constraint();
+    start_counting_allocations_in_this_test();
 
     // for historical reasons the suite can have a setup
     if(has_setup(suite)) {
@@ -333,6 +462,10 @@ void run_the_test_code(TestSuite *suite, CgreenTest *spec, TestReporter *reporte
     }
 
     tally_mocks(reporter);
+    finish_counting_allocations_in_this_test(spec, reporter);
+    duration = cgreen_time_duration_in_nanoseconds(test_starting_time, cgreen_time_get_current_nanoseconds());
+    send_reporter_duration(reporter, duration);
+    journal_test_finished(duration);
 }
 
 void die(const char *message, ...) {
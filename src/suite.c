@@ -53,6 +53,9 @@ TestSuite *create_named_test_suite_(const char *name, const char *filename, int
     suite->setup = &do_nothing;
     suite->teardown = &do_nothing;
     suite->size = 0;
+    suite->before_all = &do_nothing;
+    suite->after_all = &do_nothing;
+    suite->timeout = 0;
     return suite;
 }
 
@@ -109,6 +112,18 @@ void set_teardown(TestSuite *suite, void (*tear_down)(void)) {
     suite->teardown = tear_down;
 }
 
+void set_before_all(TestSuite *suite, void (*before_all)(void)) {
+    suite->before_all = before_all;
+}
+
+void set_after_all(TestSuite *suite, void (*after_all)(void)) {
+    suite->after_all = after_all;
+}
+
+void set_test_timeout(TestSuite *suite, unsigned int milliseconds) {
+    suite->timeout = milliseconds;
+}
+
 int count_tests(TestSuite *suite) {
     int count = 0;
     int i;
@@ -6,6 +6,7 @@
 #include <stdbool.h>
 
 #include <cgreen/text_reporter.h>
+#include "cgreen/internal/cgreen_time.h"
 #include "text_reporter_internal.h"
 
 #ifdef __ANDROID__
@@ -24,10 +25,10 @@ static void text_reporter_start_suite(TestReporter *reporter, const char *name,
 static void text_reporter_start_test(TestReporter *reporter, const char *name);
 static void text_reporter_finish(TestReporter *reporter, const char *filename,
         int line, const char *message);
-static void show_fail(TestReporter *reporter, const char *file, int line,
-        const char *message, va_list arguments);
-static void show_incomplete(TestReporter *reporter, const char *file, int line,
-        const char *message, va_list arguments);
+static void report_fail(TestReporter *reporter, CgreenEvent *event);
+static void report_incomplete(TestReporter *reporter, CgreenEvent *event);
+static void show_benchmark(TestReporter *reporter, const char *file, int line,
+                           const CgreenBenchmarkStatistics *statistics);
 static void show_breadcrumb(const char *name, void *memo);
 static void text_reporter_finish_suite(TestReporter *reporter, const char *file, int line);
 
@@ -74,8 +75,9 @@ TestReporter *create_text_reporter(void) {
 
     reporter->start_suite = &text_reporter_start_suite;
     reporter->start_test = &text_reporter_start_test;
-    reporter->show_fail = &show_fail;
-    reporter->show_incomplete = &show_incomplete;
+    reporter->report_fail = &report_fail;
+    reporter->report_incomplete = &report_incomplete;
+    reporter->show_benchmark = &show_benchmark;
     reporter->finish_test = &text_reporter_finish;
     reporter->finish_suite = &text_reporter_finish_suite;
 
@@ -98,6 +100,10 @@ static bool inhibit_finish_suite_message(TestReporter *reporter) {
     return reporter->options&&((TextReporterOptions *)reporter->options)->inhibit_finish_suite_message;
 }
 
+static bool have_verbose_mode(TestReporter *reporter) {
+    return reporter->options&&((TextReporterOptions *)reporter->options)->verbose_mode;
+}
+
 static void text_reporter_start_suite(TestReporter *reporter, const char *name,
         const int number_of_tests) {
     TextMemo *memo = (TextMemo *)reporter->memo;
@@ -122,9 +128,36 @@ static void text_reporter_start_test(TestReporter *reporter, const char *name) {
     reporter_start_test(reporter, name);
 }
 
+static void show_test_details(TestReporter *reporter, const char *name) {
+    TextMemo *memo = (TextMemo *)reporter->memo;
+    CgreenResourceUsage *usage = &reporter->resource_usage;
+
+    memo->printer("  \"%s\": %lums", name,
+                  (unsigned long)(reporter->duration_ns / CGREEN_NANOSECONDS_PER_MILLISECOND));
+    if (usage->measured)
+        memo->printer(", user %lums, system %lums, max RSS %ldkB, %ld major/%ld minor page faults,"
+                      " %ld voluntary/%ld involuntary context switches",
+                      (unsigned long)(usage->user_time / CGREEN_NANOSECONDS_PER_MILLISECOND),
+                      (unsigned long)(usage->system_time / CGREEN_NANOSECONDS_PER_MILLISECOND),
+                      usage->max_resident_set_size,
+                      usage->major_page_faults, usage->minor_page_faults,
+                      usage->voluntary_context_switches, usage->involuntary_context_switches);
+    if (usage->allocations.counted)
+        memo->printer(", %lu allocations of %lu bytes, peak %lu bytes, %ld unfreed",
+                      (unsigned long)usage->allocations.allocations,
+                      (unsigned long)usage->allocations.bytes,
+                      (unsigned long)usage->allocations.peak_bytes,
+                      (long)usage->allocations.unfreed_allocations);
+    memo->printer(".\n");
+}
+
 static void text_reporter_finish(TestReporter *reporter, const char *filename,
         int line, const char *message) {
+    const char *name = get_current_from_breadcrumb((CgreenBreadcrumb *) reporter->breadcrumb);
+
     reporter_finish_test(reporter, filename, line, message);
+    if (have_verbose_mode(reporter) && !have_quiet_mode(reporter))
+        show_test_details(reporter, name);
 }
 
 
@@ -158,9 +191,9 @@ static char *format_exceptions(int exceptions, bool use_colors) {
     return buff;
 }
 
-static char *format_duration(uint32_t duration) {
+static char *format_duration(uint64_t duration) {
     static char buff[100];
-    snprintf(buff, sizeof(buff), " in %dms", duration);
+    snprintf(buff, sizeof(buff), " in %lums", (unsigned long)(duration / CGREEN_NANOSECONDS_PER_MILLISECOND));
     return buff;
 }
 
@@ -170,7 +203,7 @@ static void insert_comma(char buf[]) {
 }
 
 static void text_reporter_print_results(char *buf, char *prepend,
-    int passes, int failures, int skips, int exceptions, uint32_t duration,
+    int passes, int failures, int skips, int exceptions, uint64_t duration,
     bool use_colors) {
 
     sprintf(buf, "%s", prepend);
@@ -229,7 +262,7 @@ static void text_reporter_finish_suite(TestReporter *reporter, const char *file,
                 reporter->failures,
                 reporter->skips,
                 reporter->exceptions,
-                reporter->duration,
+                reporter->duration_ns,
                 use_colors);
 
         // Don't report top-level (pseudo-suite) if it had no asserts at all
@@ -247,7 +280,7 @@ static void text_reporter_finish_suite(TestReporter *reporter, const char *file,
                                             reporter->total_failures,
                                             reporter->total_skips,
                                             reporter->total_exceptions,
-                                            reporter->total_duration,
+                                            reporter->total_duration_ns,
                                             use_colors);
                 memo->printer("%s.\n", buf);
             }
@@ -255,11 +288,12 @@ static void text_reporter_finish_suite(TestReporter *reporter, const char *file,
     }
 }
 
-static void show_fail(TestReporter *reporter, const char *file, int line,
-                      const char *message, va_list arguments) {
+static void report_fail(TestReporter *reporter, CgreenEvent *event) {
     TextMemo *memo = (TextMemo *)reporter->memo;
+    const char *message = cgreen_event_message(event);
+
     if (have_quiet_mode(reporter)) memo->printer("\n");
-    memo->printer("%s:%d: ", file, line);
+    memo->printer("%s:%d: ", event->file, event->line);
     memo->printer("Failure: ");
     memo->depth = 0;
     walk_breadcrumb((CgreenBreadcrumb *) reporter->breadcrumb, &show_breadcrumb, memo);
@@ -268,18 +302,18 @@ static void show_fail(TestReporter *reporter, const char *file, int line,
     if (message == NULL) {
         memo->printer("<FATAL: NULL for failure message>");
     } else {
-        memo->vprinter(message, arguments);
+        memo->printer("%s", message);
     }
     memo->printer("\n");
     memo->printer("\n");
     fflush(NULL);
 }
 
-static void show_incomplete(TestReporter *reporter, const char *file, int line,
-                            const char *message, va_list arguments) {
+static void report_incomplete(TestReporter *reporter, CgreenEvent *event) {
     TextMemo *memo = (TextMemo *)reporter->memo;
+    const char *message = cgreen_event_message(event);
 
-    memo->printer("%s:%d: ", file, line);
+    memo->printer("%s:%d: ", event->file, event->line);
     memo->printer("Exception: ");
 
     memo->depth = 0;
@@ -291,13 +325,34 @@ static void show_incomplete(TestReporter *reporter, const char *file, int line,
         memo->printer("Test terminated unexpectedly, "
                 "likely from a non-standard exception or Posix signal");
     } else {
-        memo->vprinter(message, arguments);
+        memo->printer("%s", message);
     }
     memo->printer("\n");
     memo->printer("\n");
     fflush(NULL);
 }
 
+static void show_benchmark(TestReporter *reporter, const char *file, int line,
+                           const CgreenBenchmarkStatistics *statistics) {
+    TextMemo *memo = (TextMemo *)reporter->memo;
+
+    if (have_quiet_mode(reporter))
+        return;
+    memo->printer("%s:%d: ", file, line);
+    memo->printer("Benchmark: ");
+    memo->depth = 0;
+    walk_breadcrumb((CgreenBreadcrumb *) reporter->breadcrumb, &show_breadcrumb, memo);
+    memo->printer("\n\t");
+    memo->printer("%d samples of %lu iterations, per iteration: min %.1fns, median %.1fns,"
+                  " mean %.1fns, p99 %.1fns, stddev %.1fns",
+                  statistics->samples, (unsigned long)statistics->iterations,
+                  statistics->minimum, statistics->median, statistics->mean,
+                  statistics->percentile_99, statistics->standard_deviation);
+    memo->printer("\n");
+    memo->printer("\n");
+    fflush(NULL);
+}
+
 static void show_breadcrumb(const char *name, void *memo_ptr) {
     TextMemo *memo = (TextMemo *)memo_ptr;
     if (memo->depth > 1) {
@@ -0,0 +1,32 @@
+#ifdef WIN32
+
+#include "cgreen/internal/cgreen_lock.h"
+
+#include <stdlib.h>
+#include <windows.h>
+
+/* A critical section can already be entered again by its owner */
+struct CgreenLock_ {
+    CRITICAL_SECTION section;
+};
+
+CgreenLock *cgreen_lock_create(void) {
+    CgreenLock *lock = (CgreenLock *)malloc(sizeof(CgreenLock));
+
+    if (lock == NULL)
+        return NULL;
+    InitializeCriticalSection(&lock->section);
+    return lock;
+}
+
+void cgreen_lock_take(CgreenLock *lock) {
+    EnterCriticalSection(&lock->section);
+}
+
+void cgreen_lock_release(CgreenLock *lock) {
+    LeaveCriticalSection(&lock->section);
+}
+
+#endif
+
+/* vim: set ts=4 sw=4 et cindent: */
@@ -4,12 +4,11 @@
 #include <unistd.h>
 #include <windows.h>
 #include <stdbool.h>
-#include <math.h>
 
 static LARGE_INTEGER qry_freq;
 static bool qry_freq_initialized = false;
 
-uint32_t cgreen_time_get_current_milliseconds() {
+uint64_t cgreen_time_get_current_nanoseconds(void) {
     if (!qry_freq_initialized) {
         QueryPerformanceFrequency(&qry_freq);
         qry_freq_initialized = true;
@@ -18,9 +17,9 @@ uint32_t cgreen_time_get_current_milliseconds() {
     LARGE_INTEGER current_count;
     QueryPerformanceCounter(&current_count);
 
-    current_count.QuadPart = current_count.QuadPart * 1000000 / qry_freq.QuadPart;
-
-    return trunc(current_count.QuadPart / 1000);
+    /* Split to not overflow the multiplication for long uptimes */
+    return (uint64_t)(current_count.QuadPart / qry_freq.QuadPart) * CGREEN_NANOSECONDS_PER_SECOND
+        + (uint64_t)(current_count.QuadPart % qry_freq.QuadPart) * CGREEN_NANOSECONDS_PER_SECOND / qry_freq.QuadPart;
 }
 
 /* vim: set ts=4 sw=4 et cindent: */
@@ -57,12 +57,12 @@ static void run_named_test_child(TestSuite *suite, const char *name, TestReporte
             //This may have undesireable side effects.  Not sure of the best solution
             (*reporter->start_suite)(reporter, newSuite->name, count_tests(newSuite));
 
-            uint32_t test_starting_milliseconds = cgreen_time_get_current_milliseconds();
+            uint64_t test_starting_time = cgreen_time_get_current_nanoseconds();
 
             run_named_test_child(newSuite, name, reporter);
 
-            reporter->duration = cgreen_time_duration_in_milliseconds(test_starting_milliseconds,
-                                                                          cgreen_time_get_current_milliseconds());
+            reporter->duration_ns = cgreen_time_duration_in_nanoseconds(test_starting_time,
+                                                                          cgreen_time_get_current_nanoseconds());
 
             (*reporter->finish_suite)(reporter, newSuite->filename, newSuite->line, test_duration);
             (*suite->teardown)();
@@ -84,12 +84,12 @@ void run_specified_test_if_child(TestSuite *suite, TestReporter *reporter){
         //best solution for this.
         reporter_start_test(reporter, testName);  //add breadcrumb without triggering output to console
 
-        uint32_t test_starting_milliseconds = cgreen_time_get_current_milliseconds();
+        uint64_t test_starting_time = cgreen_time_get_current_nanoseconds();
 
         run_named_test_child(suite, testName, reporter);
 
-        reporter->duration = cgreen_time_duration_in_milliseconds(test_starting_milliseconds,
-                                                                      cgreen_time_get_current_milliseconds());
+        reporter->duration_ns = cgreen_time_duration_in_nanoseconds(test_starting_time,
+                                                                      cgreen_time_get_current_nanoseconds());
 
         reporter_finish_test(reporter, suite->filename, suite->line, NULL, test_duration);
 
@@ -164,20 +164,79 @@ void run_test_in_its_own_process(TestSuite *suite, CgreenTest *test, TestReporte
 
     (*reporter->start_test)(reporter, test->name);
 
-    uint32_t test_starting_milliseconds = cgreen_time_get_current_milliseconds();
+    uint64_t test_starting_time = cgreen_time_get_current_nanoseconds();
+    unsigned int timeout = timeout_for(suite, test);
 
     //success = CreateProcessA(fname, NULL, NULL, NULL, true, NORMAL_PRIORITY_CLASS | CREATE_NO_WINDOW , p_environment, NULL, &siStartupInfo, &piProcessInfo);
     success = CreateProcessA(fname, NULL, NULL, NULL, true, NORMAL_PRIORITY_CLASS , p_environment, NULL, &siStartupInfo, &piProcessInfo);
     dispose_environment(p_environment);
-    WaitForSingleObject(piProcessInfo.hProcess,INFINITE);
+    if (WaitForSingleObject(piProcessInfo.hProcess, timeout > 0 ? timeout : INFINITE) == WAIT_TIMEOUT) {
+        char message[128];
+        TerminateProcess(piProcessInfo.hProcess, EXIT_FAILURE);
+        WaitForSingleObject(piProcessInfo.hProcess, INFINITE);
+        reporter->duration_ns = cgreen_time_duration_in_nanoseconds(test_starting_time,
+                                                                  cgreen_time_get_current_nanoseconds());
+        sprintf_s(message, sizeof(message), "Test timed out after %u ms", timeout);
+        (*reporter->finish_test)(reporter, test->filename, test->line, message, test_duration);
+        return;
+    }
 
-    reporter->duration = cgreen_time_duration_in_milliseconds(test_starting_milliseconds,
-                                                                  cgreen_time_get_current_milliseconds());
+    reporter->duration_ns = cgreen_time_duration_in_nanoseconds(test_starting_time,
+                                                                  cgreen_time_get_current_nanoseconds());
 
     (*reporter->finish_test)(reporter, test->filename, test->line, NULL, test_duration);
 
     return;
 }
 
+/* Windows has no fork(), and starting one process per test is already
+   expensive, so parallel runs are just run one test at a time */
+void run_tests_in_parallel_processes(TestSuite *suite, CgreenTest **tests, int count,
+                                     TestReporter *reporter, int jobs) {
+    int i;
+    (void)jobs;
+
+    for (i = 0; i < count; i++)
+        run_test_in_its_own_process(suite, tests[i], reporter);
+}
+
+void run_tests_in_worker_pool(TestSuite *suite, CgreenTest **tests, int count,
+                              TestReporter *reporter, int workers, bool retire_when_dirty) {
+    (void)retire_when_dirty;
+    run_tests_in_parallel_processes(suite, tests, count, reporter, workers);
+}
+
+void run_tests_in_library_worker(TestSuite *suite, CgreenTest **tests, int count,
+                                 TestReporter *reporter) {
+    run_tests_in_parallel_processes(suite, tests, count, reporter, 1);
+}
+
+void run_setup_in_library_worker(void (*setup)(void)) {
+    (*setup)();
+}
+
+void run_teardown_in_library_worker(void (*teardown)(void)) {
+    (*teardown)();
+}
+
+void stop_library_worker(void) {
+}
+
+/* Tests are only run in this process when debugging, so no watchdog */
+void start_watchdog_in_this_process(CgreenTest *test, unsigned int timeout) {
+    (void)test;
+    (void)timeout;
+}
+
+void stop_watchdog_in_this_process(void) {
+}
+
+void start_resource_measurement_in_this_process(void) {
+}
+
+void finish_resource_measurement_in_this_process(CgreenResourceUsage *usage) {
+    usage->measured = 0;
+}
+
 #endif
 /* vim: set ts=4 sw=4 et cindent: */
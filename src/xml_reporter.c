@@ -4,8 +4,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <stdarg.h>
+#include <stdbool.h>
 
 
+#include "cgreen/internal/cgreen_time.h"
 #include "xml_reporter_internal.h"
 
 #ifdef __ANDROID__
@@ -26,10 +29,10 @@ static void xml_reporter_finish_test(TestReporter *reporter, const char *filenam
 static void xml_reporter_finish_suite(TestReporter *reporter, const char *filename,
                                       int line);
 static void xml_show_skip(TestReporter *reporter, const char *file, int line);
-static void xml_show_fail(TestReporter *reporter, const char *file, int line,
-                          const char *message, va_list arguments);
-static void xml_show_incomplete(TestReporter *reporter, const char *filename,
-                                int line, const char *message, va_list arguments);
+static void xml_report_fail(TestReporter *reporter, CgreenEvent *event);
+static void xml_show_benchmark(TestReporter *reporter, const char *file, int line,
+                               const CgreenBenchmarkStatistics *statistics);
+static void xml_report_incomplete(TestReporter *reporter, CgreenEvent *event);
 
 
 void set_xml_reporter_printer(TestReporter *reporter, XmlPrinter *new_printer) {
@@ -59,9 +62,10 @@ TestReporter *create_xml_reporter(const char *prefix) {
     file_prefix = prefix;
     reporter->start_suite = &xml_reporter_start_suite;
     reporter->start_test = &xml_reporter_start_test;
-    reporter->show_fail = &xml_show_fail;
+    reporter->report_fail = &xml_report_fail;
     reporter->show_skip = &xml_show_skip;
-    reporter->show_incomplete = &xml_show_incomplete;
+    reporter->report_incomplete = &xml_report_incomplete;
+    reporter->show_benchmark = &xml_show_benchmark;
     reporter->finish_test = &xml_reporter_finish_test;
     reporter->finish_suite = &xml_reporter_finish_suite;
     return reporter;
@@ -147,13 +151,13 @@ static void xml_reporter_start_suite(TestReporter *reporter, const char *suitena
 }
 
 
-/* Accumulate output from the actual test (the "<testcase>" nodes) in
-   a file since the tests usually are run in a child processes, so
-   there is no simple way to save output from it and then use it in
-   the parent (start_test() and finish_test() are run from parent) */
+/* The "<testcase>" node can't be terminated until its duration is
+   known, when the test is finished, so what the test shows is
+   collected until then. Everything is shown in this process, even when
+   the test runs in a process of its own. */
 
 static char *output = NULL;
-static FILE *child_output_tmpfile;
+static char *properties = NULL;
 
 static void xml_reporter_start_test(TestReporter *reporter, const char *testname) {
     XmlMemo *memo = (XmlMemo *)reporter->memo;
@@ -169,8 +173,7 @@ static void xml_reporter_start_test(TestReporter *reporter, const char *testname
     memo->printer(out, "\" name=\"%s\"", testname);
     reporter_start_test(reporter, testname);
     output = strdup("");
-
-    child_output_tmpfile = tmpfile();
+    properties = strdup("");
 }
 
 
@@ -185,67 +188,145 @@ static void xml_show_skip(TestReporter *reporter, const char *file, int line) {
 
     output = concat(output, indent(reporter));
     output = concat(output, "\t<skipped />\n");
-
-    fputs(output, child_output_tmpfile);
 }
 
-static void xml_show_fail(TestReporter *reporter, const char *file, int line, const char *message, va_list arguments) {
+static void xml_report_fail(TestReporter *reporter, CgreenEvent *event) {
+    const char *message = cgreen_event_message(event);
     char buffer[1000];
 
     output = concat(output, indent(reporter));
     output = concat(output, "<failure message=\"");
+    output = concat(output, message != NULL ? message : "");
+    output = concat(output, "\">\n");
+    output = concat(output, indent(reporter));
 
-    vsnprintf(buffer, sizeof(buffer)/sizeof(buffer[0]), message, arguments);
+    snprintf(buffer, sizeof(buffer)/sizeof(buffer[0]),
+             "\t<location file=\"%s\" line=\"%d\"/>\n", event->file, event->line);
     output = concat(output, buffer);
+    output = concat(output, indent(reporter));
+    output = concat(output, "</failure>\n");
+}
+
+static void xml_report_incomplete(TestReporter *reporter, CgreenEvent *event) {
+    const char *message = cgreen_event_message(event);
+    char buffer[1000];
+
+    output = concat(output, indent(reporter));
+    output = concat(output, "<error type=\"Fatal\" message=\"");
+    output = concat(output, message ? message: "Test terminated unexpectedly, likely from a non-standard exception or Posix signal");
     output = concat(output, "\">\n");
     output = concat(output, indent(reporter));
 
     snprintf(buffer, sizeof(buffer)/sizeof(buffer[0]),
-             "\t<location file=\"%s\" line=\"%d\"/>\n", file, line);
+             "\t<location file=\"%s\" line=\"%d\"/>\n", event->file, event->line);
     output = concat(output, buffer);
     output = concat(output, indent(reporter));
-    output = concat(output, "</failure>\n");
+    output = concat(output, "</error>\n");
+}
+
+
+/* Benchmark statistics are properties, which have to be put before
+   anything else in the "<testcase>" */
+static void xml_show_benchmark(TestReporter *reporter, const char *file, int line,
+                               const CgreenBenchmarkStatistics *statistics) {
+    const char *names[] = { "minimum", "median", "mean", "percentile_99", "standard_deviation" };
+    double values[5];
+    char buffer[200];
+    int i;
+    (void)file;
+    (void)line;
 
-    fputs(output, child_output_tmpfile);
+    values[0] = statistics->minimum;
+    values[1] = statistics->median;
+    values[2] = statistics->mean;
+    values[3] = statistics->percentile_99;
+    values[4] = statistics->standard_deviation;
+
+    snprintf(buffer, sizeof(buffer), "%s\t\t<property name=\"benchmark_iterations\" value=\"%lu\"/>\n",
+             indent(reporter), (unsigned long)statistics->iterations);
+    properties = concat(properties, buffer);
+    snprintf(buffer, sizeof(buffer), "%s\t\t<property name=\"benchmark_samples\" value=\"%d\"/>\n",
+             indent(reporter), statistics->samples);
+    properties = concat(properties, buffer);
+    for (i = 0; i < 5; i++) {
+        snprintf(buffer, sizeof(buffer), "%s\t\t<property name=\"benchmark_%s_ns\" value=\"%.1f\"/>\n",
+                 indent(reporter), names[i], values[i]);
+        properties = concat(properties, buffer);
+    }
 }
 
-static void xml_show_incomplete(TestReporter *reporter, const char *filename, int line, const char *message, va_list arguments) {
+
+static void print_property(TestReporter *reporter, FILE *out, const char *name, const char *format, ...) {
     XmlMemo *memo = (XmlMemo *)reporter->memo;
-    FILE *out = file_stack[file_stack_p-1];
+    char value[100];
+    va_list arguments;
 
-    memo->printer(out, ">\n");
-    memo->printer(out, indent(reporter));
-    memo->printer(out, "<error type=\"Fatal\" message=\"");
-    memo->printer(out, message ? message: "Test terminated unexpectedly, likely from a non-standard exception or Posix signal", arguments);
-    memo->printer(out, "\">\n");
+    va_start(arguments, format);
+    vsnprintf(value, sizeof(value), format, arguments);
+    va_end(arguments);
     memo->printer(out, indent(reporter));
-    memo->printer(out, "\t<location file=\"%s\" line=\"%d\"/>\n", filename, line);
-    memo->printer(out, indent(reporter));
-    memo->printer(out, "</error>\n");
-    fflush(out);
+    memo->printer(out, "\t\t<property name=\"%s\" value=\"%s\"/>\n", name, value);
 }
 
+/* Times are in seconds, as the time of the test case is */
+static void xml_show_resource_usage(TestReporter *reporter, FILE *out) {
+    CgreenResourceUsage *usage = &reporter->resource_usage;
+
+    print_property(reporter, out, "user_time", "%.6f",
+                   (double)usage->user_time/(double)CGREEN_NANOSECONDS_PER_SECOND);
+    print_property(reporter, out, "system_time", "%.6f",
+                   (double)usage->system_time/(double)CGREEN_NANOSECONDS_PER_SECOND);
+    print_property(reporter, out, "max_resident_set_size_kb", "%ld", usage->max_resident_set_size);
+    print_property(reporter, out, "major_page_faults", "%ld", usage->major_page_faults);
+    print_property(reporter, out, "minor_page_faults", "%ld", usage->minor_page_faults);
+    print_property(reporter, out, "voluntary_context_switches", "%ld",
+                   usage->voluntary_context_switches);
+    print_property(reporter, out, "involuntary_context_switches", "%ld",
+                   usage->involuntary_context_switches);
+}
 
-static void transfer_output_from(FILE *tmpfile, XmlPrinter printer, FILE *out) {
-    fseek(tmpfile, 0, SEEK_SET);
-    char buffer[1000];
-    while (fgets(buffer, 1000, tmpfile) != NULL)
-        printer(out, buffer);
+static void xml_show_allocation_usage(TestReporter *reporter, FILE *out) {
+    CgreenAllocationUsage *usage = &reporter->resource_usage.allocations;
+
+    print_property(reporter, out, "allocations", "%lu", (unsigned long)usage->allocations);
+    print_property(reporter, out, "allocated_bytes", "%lu", (unsigned long)usage->bytes);
+    print_property(reporter, out, "peak_allocated_bytes", "%lu", (unsigned long)usage->peak_bytes);
+    print_property(reporter, out, "unfreed_allocations", "%ld", (long)usage->unfreed_allocations);
+    print_property(reporter, out, "unfreed_bytes", "%ld", (long)usage->unfreed_bytes);
 }
 
+static void xml_show_properties(TestReporter *reporter, FILE *out) {
+    XmlMemo *memo = (XmlMemo *)reporter->memo;
+    bool measured = reporter->resource_usage.measured;
+    bool counted = reporter->resource_usage.allocations.counted;
+    bool benchmarked = properties[0] != '\0';
+
+    if (!measured && !counted && !benchmarked)
+        return;
+    memo->printer(out, indent(reporter));
+    memo->printer(out, "\t<properties>\n");
+    if (benchmarked)
+        memo->printer(out, "%s", properties);
+    if (measured)
+        xml_show_resource_usage(reporter, out);
+    if (counted)
+        xml_show_allocation_usage(reporter, out);
+    memo->printer(out, indent(reporter));
+    memo->printer(out, "\t</properties>\n");
+}
 
 static void xml_reporter_finish_test(TestReporter *reporter, const char *filename, int line, const char *message) {
     XmlMemo *memo = (XmlMemo *)reporter->memo;
     FILE *out = file_stack[file_stack_p-1];
 
     reporter_finish_test(reporter, filename, line, message);
-    memo->printer(out, " time=\"%.5f\">\n", (double)reporter->duration/(double)1000);
-    if (output && strlen(output) == 0) {
-        free(output);
-        output = NULL;
-    }
-
-    transfer_output_from(child_output_tmpfile, memo->printer, out);
+    memo->printer(out, " time=\"%.6f\">\n", (double)reporter->duration_ns/(double)CGREEN_NANOSECONDS_PER_SECOND);
+    xml_show_properties(reporter, out);
+    memo->printer(out, "%s", output);
+    free(output);
+    output = NULL;
+    free(properties);
+    properties = NULL;
 
     memo->printer(out, indent(reporter));
     memo->printer(out, "</testcase>\n");
@@ -7,7 +7,9 @@
 using namespace cgreen;
 #endif
 
+TestSuite *allocation_tests(void);
 TestSuite *assertion_tests(void);
+TestSuite *before_all_tests(void);
 TestSuite *breadcrumb_tests(void);
 TestSuite *cdash_reporter_tests(void);
 TestSuite *collector_tests(void);
@@ -17,6 +19,7 @@ TestSuite *cpp_assertion_tests(void);
 #endif
 TestSuite *cute_reporter_tests(void);
 TestSuite *cgreen_value_tests(void);
+TestSuite *journal_tests(void);
 TestSuite *message_formatting_tests(void);
 TestSuite *messaging_tests(void);
 TestSuite *mock_tests(void);
@@ -33,14 +36,18 @@ int main(int argc, char **argv) {
     TestSuite *suite = create_named_test_suite("all_c_tests");
     TestReporter *reporter = create_text_reporter(); 
 
+    add_suite(suite, allocation_tests());
     add_suite(suite, assertion_tests());
+    add_suite(suite, before_all_tests());
     add_suite(suite, breadcrumb_tests());
     add_suite(suite, cdash_reporter_tests());
+    add_suite(suite, collector_tests());
     add_suite(suite, constraint_tests());
 #ifdef __cplusplus
     add_suite(suite, cpp_assertion_tests());
 #endif
     add_suite(suite, cute_reporter_tests());
+    add_suite(suite, journal_tests());
     add_suite(suite, message_formatting_tests());
     add_suite(suite, messaging_tests());
     add_suite(suite, mock_tests());
@@ -0,0 +1,39 @@
+#include <cgreen/cgreen.h>
+
+#include <stdlib.h>
+
+#ifdef __cplusplus
+using namespace cgreen;
+#endif
+
+static void *volatile allocated;
+
+static void allocate_and_free(size_t size) {
+    allocated = malloc(size);
+    free((void *)allocated);
+}
+
+Describe(AllocationMessage);
+BeforeEach(AllocationMessage) {}
+AfterEach(AllocationMessage) {}
+
+Ensure(AllocationMessage, for_memory_not_freed_when_no_net_allocations_are_expected) {
+    expect_no_net_allocations();
+    allocated = malloc(100);
+}
+
+Ensure(AllocationMessage, for_allocations_in_code_that_should_not_allocate) {
+    assert_that(allocations_during(allocate_and_free(100)), is_equal_to(0));
+}
+
+Ensure(AllocationMessage, counts_only_what_is_allocated_after_no_net_allocations_are_expected) {
+    void *allocated_before = malloc(100);
+
+    expect_no_net_allocations();
+    free(allocated_before);
+    allocated = malloc(100);
+}
+
+Ensure(AllocationMessage, is_not_given_for_memory_not_freed_when_net_allocations_are_allowed) {
+    allocated = malloc(100);
+}
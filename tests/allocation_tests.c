@@ -0,0 +1,72 @@
+#include <cgreen/cgreen.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+using namespace cgreen;
+#endif
+
+/* Stored in a volatile so that the compiler can't optimise the
+   allocations away */
+static void *volatile allocated;
+
+static void allocate_and_free(size_t size) {
+    allocated = malloc(size);
+    free((void *)allocated);
+}
+
+static void grow_and_free(size_t size) {
+    allocated = malloc(size);
+    allocated = realloc((void *)allocated, 2*size);
+    free((void *)allocated);
+}
+
+static int add(int a, int b) {
+    return a + b;
+}
+
+Describe(Allocations);
+BeforeEach(Allocations) {}
+AfterEach(Allocations) {}
+
+Ensure(Allocations, are_not_counted_for_code_that_does_not_allocate) {
+    assert_that(allocations_during(add(1, 2)), is_equal_to(0));
+    assert_that(bytes_allocated_during(add(1, 2)), is_equal_to(0));
+}
+
+Ensure(Allocations, are_counted_during_an_expression) {
+    if (!allocations_can_be_counted())
+        return;
+    assert_that(allocations_during(allocate_and_free(100)), is_equal_to(1));
+    assert_that(allocations_during((allocate_and_free(100), allocate_and_free(100))), is_equal_to(2));
+}
+
+Ensure(Allocations, count_at_least_the_bytes_asked_for) {
+    if (!allocations_can_be_counted())
+        return;
+    assert_that(bytes_allocated_during(allocate_and_free(100)), is_greater_than(99));
+}
+
+Ensure(Allocations, count_reallocations_as_new_allocations) {
+    if (!allocations_can_be_counted())
+        return;
+    assert_that(allocations_during(grow_and_free(100)), is_equal_to(2));
+    assert_that(bytes_allocated_during(grow_and_free(100)), is_greater_than(299));
+}
+
+Ensure(Allocations, can_be_expected_to_be_freed_by_the_end_of_the_test) {
+    expect_no_net_allocations();
+    allocated = malloc(100);
+    free((void *)allocated);
+}
+
+TestSuite *allocation_tests(void) {
+    TestSuite *suite = create_test_suite();
+    add_test_with_context(suite, Allocations, are_not_counted_for_code_that_does_not_allocate);
+    add_test_with_context(suite, Allocations, are_counted_during_an_expression);
+    add_test_with_context(suite, Allocations, count_at_least_the_bytes_asked_for);
+    add_test_with_context(suite, Allocations, count_reallocations_as_new_allocations);
+    add_test_with_context(suite, Allocations, can_be_expected_to_be_freed_by_the_end_of_the_test);
+    return suite;
+}
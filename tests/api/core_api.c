@@ -19,6 +19,14 @@ Ensure(assert_that_compiles) {
     significant_figures_for_assert_double_are(3);
 }
 
+// ALLOCATIONS
+Ensure(allocations_compiles) {
+    expect_no_net_allocations();
+    assert_that(allocations_during(free(malloc(1))), is_equal_to(0));
+    assert_that(bytes_allocated_during(free(malloc(1))), is_equal_to(0));
+    assert_that(allocations_can_be_counted());
+}
+
 // CONSTRAINTS
 Ensure(constraints_compiles) {
     char array[5];
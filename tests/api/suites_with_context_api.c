@@ -5,18 +5,46 @@ using namespace cgreen;
 #endif
 
 Describe(context_api);
+BeforeAll(context_api) {}
 BeforeEach(context_api) {}
 AfterEach(context_api) {}
+AfterAll(context_api) {}
+Timeout(context_api, 1000);
+
+EnsureWithin(100, context_api, compiles_timed_test) {}
+
+Benchmark(context_api, compiles_benchmark) {
+    uint64_t i;
+
+    for (i = 0; i < benchmark_iterations(benchmark); i++) {
+        pause_benchmark_timing(benchmark);
+        resume_benchmark_timing(benchmark);
+        benchmark_use(&i);
+    }
+}
+
+xBenchmark(context_api, compiles_ignored_benchmark) {
+    benchmark_use(benchmark);
+}
 
 // SUITES
 Ensure(context_api, compiles_suite_api) {
     TestSuite *suite = create_test_suite();
 
     add_test_with_context(suite, context_api, compiles_suite_api);
+    set_before_all(suite, BeforeAll_For_context_api);
+    set_after_all(suite, AfterAll_For_context_api);
 
     run_test_suite(suite, NULL);
+    run_test_suite_parallel(suite, NULL, 2);
     run_single_test(suite, "name", NULL);
 
+    set_test_isolation(isolate_tests);
+    set_test_isolation(isolate_contexts);
+    set_test_isolation(isolate_library);
+
+    set_test_timeout(suite, 100);
+
     die_in(1);
 
     destroy_test_suite(suite);
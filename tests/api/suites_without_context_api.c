@@ -6,6 +6,10 @@ using namespace cgreen;
 
 // SUITES
 Ensure(a_test) {}
+EnsureWithin(100, a_timed_test) {}
+Benchmark(a_benchmark) {
+    benchmark_use(benchmark);
+}
 
 Ensure(suites_compiles) {
     TestSuite *suite = create_test_suite();
@@ -14,9 +18,19 @@ Ensure(suites_compiles) {
     add_tests(suite, a_test, a_test, a_test);
 
     run_test_suite(suite, NULL);
+    run_test_suite_parallel(suite, NULL, 2);
     run_single_test(suite, "name", NULL);
 
+    set_test_isolation(isolate_tests);
+    set_test_isolation(isolate_contexts);
+    set_test_isolation(isolate_library);
+
+    set_test_timeout(suite, 100);
+
     die_in(1);
 
+    save_benchmarks_as_baseline("baseline");
+    compare_benchmarks_with_baseline("baseline", 10.0);
+
     destroy_test_suite(suite);
 }
@@ -0,0 +1,43 @@
+#include <cgreen/cgreen.h>
+
+#ifdef __cplusplus
+using namespace cgreen;
+#endif
+
+static int before_all_calls = 0;
+static int *shared_state = NULL;
+static int state = 0;
+
+Describe(BeforeAll);
+
+BeforeAll(BeforeAll) {
+    before_all_calls++;
+    state = 42;
+    shared_state = &state;
+}
+
+BeforeEach(BeforeAll) {}
+
+AfterEach(BeforeAll) {}
+
+AfterAll(BeforeAll) {
+    shared_state = NULL;
+}
+
+Ensure(BeforeAll, is_run_before_the_tests) {
+    assert_that(shared_state, is_non_null);
+    assert_that(*shared_state, is_equal_to(42));
+}
+
+Ensure(BeforeAll, is_run_only_once_for_all_the_tests_in_the_context) {
+    assert_that(before_all_calls, is_equal_to(1));
+}
+
+TestSuite *before_all_tests(void) {
+    TestSuite *suite = create_test_suite();
+    set_before_all(suite, BeforeAll_For_BeforeAll);
+    set_after_all(suite, AfterAll_For_BeforeAll);
+    add_test_with_context(suite, BeforeAll, is_run_before_the_tests);
+    add_test_with_context(suite, BeforeAll, is_run_only_once_for_all_the_tests_in_the_context);
+    return suite;
+}
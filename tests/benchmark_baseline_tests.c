@@ -0,0 +1,33 @@
+#include <cgreen/cgreen.h>
+
+#ifdef __cplusplus
+using namespace cgreen;
+#endif
+
+/* Compared with benchmark_baseline_tests.baseline, which has
+   impossibly small and impossibly large times for these benchmarks */
+
+Describe(BenchmarkBaseline);
+BeforeEach(BenchmarkBaseline) {}
+AfterEach(BenchmarkBaseline) {}
+
+Benchmark(BenchmarkBaseline, fails_when_slower_than_its_baseline) {
+    uint64_t i;
+
+    for (i = 0; i < benchmark_iterations(benchmark); i++)
+        benchmark_use(&i);
+}
+
+Benchmark(BenchmarkBaseline, passes_when_faster_than_its_baseline) {
+    uint64_t i;
+
+    for (i = 0; i < benchmark_iterations(benchmark); i++)
+        benchmark_use(&i);
+}
+
+Benchmark(BenchmarkBaseline, is_not_compared_when_not_in_the_baseline) {
+    uint64_t i;
+
+    for (i = 0; i < benchmark_iterations(benchmark); i++)
+        benchmark_use(&i);
+}
@@ -0,0 +1,55 @@
+#include <cgreen/cgreen.h>
+
+#include <string.h>
+
+#ifdef __cplusplus
+using namespace cgreen;
+#endif
+
+#define NUMBERS 1000
+
+static int numbers[NUMBERS];
+
+Describe(BenchmarkMessage);
+BeforeEach(BenchmarkMessage) {
+    int i;
+    for (i = 0; i < NUMBERS; i++)
+        numbers[i] = i;
+}
+AfterEach(BenchmarkMessage) {}
+
+Benchmark(BenchmarkMessage, for_summing_numbers) {
+    uint64_t i;
+    int j;
+
+    for (i = 0; i < benchmark_iterations(benchmark); i++) {
+        long sum = 0;
+        for (j = 0; j < NUMBERS; j++)
+            sum += numbers[j];
+        benchmark_use(&sum);
+    }
+}
+
+Benchmark(BenchmarkMessage, without_the_time_for_preparations) {
+    uint64_t i;
+
+    for (i = 0; i < benchmark_iterations(benchmark); i++) {
+        pause_benchmark_timing(benchmark);
+        memset(numbers, 0, sizeof(numbers));
+        resume_benchmark_timing(benchmark);
+        numbers[i % NUMBERS]++;
+        benchmark_use(numbers);
+    }
+}
+
+xBenchmark(BenchmarkMessage, is_not_given_for_an_ignored_benchmark) {
+    benchmark_use(benchmark);
+    fail_test("This benchmark should not have been run");
+}
+
+Benchmark(for_a_benchmark_without_context) {
+    uint64_t i;
+
+    for (i = 0; i < benchmark_iterations(benchmark); i++)
+        benchmark_use(&i);
+}
@@ -0,0 +1,45 @@
+#include <cgreen/cgreen.h>
+#include <cgreen/mocks.h>
+
+#ifdef __cplusplus
+using namespace cgreen;
+#endif
+
+/* Compared with benchmark_mocks_tests.baseline, which has 100ns for
+   each, so a mock has to be called ten million times a second */
+
+static int returning_mock(void) {
+    return (int)mock();
+}
+
+static int checking_mock(int first, const char *second) {
+    return (int)mock(first, second);
+}
+
+/* The body of a benchmark is run many times, but this only once */
+Describe(BenchmarkMocks);
+BeforeEach(BenchmarkMocks) {
+    always_expect(returning_mock, will_return(42));
+    always_expect(checking_mock, when(first, is_equal_to(1)), will_return(42));
+}
+AfterEach(BenchmarkMocks) {}
+
+Benchmark(BenchmarkMocks, for_a_mock_returning_a_value) {
+    uint64_t i;
+    int result;
+
+    for (i = 0; i < benchmark_iterations(benchmark); i++) {
+        result = returning_mock();
+        benchmark_use(&result);
+    }
+}
+
+Benchmark(BenchmarkMocks, for_a_mock_checking_its_parameters) {
+    uint64_t i;
+    int result;
+
+    for (i = 0; i < benchmark_iterations(benchmark); i++) {
+        result = checking_mock(1, "two");
+        benchmark_use(&result);
+    }
+}
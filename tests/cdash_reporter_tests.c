@@ -141,6 +141,38 @@ Ensure(CDashReporter, will_report_failed_once_for_each_fail) {
     assert_that(output, is_equal_to_string(""));
 }
 
+Ensure(CDashReporter, will_report_resource_usage_as_named_measurements) {
+    va_list arguments;
+
+    reporter->start_test(reporter, "test_name");
+    reporter->resource_usage.measured = 1;
+    reporter->resource_usage.minor_page_faults = 42;
+
+    memset(&arguments, 0, sizeof(va_list));
+    reporter->show_pass(reporter, "file", 2, "test_name", arguments);
+
+    assert_that(output, contains_string("name=\"Minor Page Faults\">\n       <Value>42.000000</Value>"));
+
+    send_reporter_completion_notification(reporter);
+    reporter->finish_test(reporter, "filename", line, NULL);
+}
+
+Ensure(CDashReporter, will_report_allocations_as_named_measurements) {
+    va_list arguments;
+
+    reporter->start_test(reporter, "test_name");
+    reporter->resource_usage.allocations.counted = 1;
+    reporter->resource_usage.allocations.peak_bytes = 256;
+
+    memset(&arguments, 0, sizeof(va_list));
+    reporter->show_pass(reporter, "file", 2, "test_name", arguments);
+
+    assert_that(output, contains_string("name=\"Peak Allocated Bytes\">\n       <Value>256.000000</Value>"));
+
+    send_reporter_completion_notification(reporter);
+    reporter->finish_test(reporter, "filename", line, NULL);
+}
+
 static void wrapped_show_fail(TestReporter *reporter, const char *file, int line,
         const char *message, ...) {
    va_list arguments;
@@ -182,6 +214,8 @@ TestSuite *cdash_reporter_tests(void) {
     add_test_with_context(suite, CDashReporter, will_report_nothing_for_suites);
     add_test_with_context(suite, CDashReporter, will_report_passed_for_test_with_one_pass);
     add_test_with_context(suite, CDashReporter, will_report_failed_once_for_each_fail);
+    add_test_with_context(suite, CDashReporter, will_report_resource_usage_as_named_measurements);
+    add_test_with_context(suite, CDashReporter, will_report_allocations_as_named_measurements);
     add_test_with_context(suite, CDashReporter, will_report_non_finishing_test);
     
     set_teardown(suite, teardown_cdash_reporter_tests);
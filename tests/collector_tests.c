@@ -0,0 +1,163 @@
+#include <cgreen/cgreen.h>
+
+#ifndef WIN32
+#include <cgreen/internal/cgreen_collector.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#ifdef __cplusplus
+using namespace cgreen;
+#endif
+
+#ifndef WIN32
+static CgreenCollector *collector;
+
+/* The child waits until it can read from, or sees the end of, 'go' */
+static pid_t start_process_waiting_for(int go[2], int exit_pipe[2]) {
+    pid_t child;
+
+    if (pipe(exit_pipe) != 0)
+        return -1;
+    child = fork();
+    if (child == 0) {
+        char ignored;
+        close(go[1]);
+        close(exit_pipe[0]);
+        if (read(go[0], &ignored, 1) < 0)
+            _exit(1);
+        _exit(0);
+    }
+    close(exit_pipe[1]);
+    return child;
+}
+
+static pid_t start_process(int exit_pipe[2]) {
+    pid_t child;
+
+    if (pipe(exit_pipe) != 0)
+        return -1;
+    child = fork();
+    if (child == 0)
+        _exit(0);
+    close(exit_pipe[1]);
+    return child;
+}
+
+Describe(Collector);
+BeforeEach(Collector) {
+    collector = cgreen_collector_open();
+}
+AfterEach(Collector) {
+    cgreen_collector_close(collector);
+}
+
+Ensure(Collector, tells_which_process_has_exited) {
+    int exit_pipe[2];
+    int context;
+    void *ready[4];
+    pid_t child = start_process(exit_pipe);
+
+    cgreen_collector_watch_exit(collector, child, exit_pipe[0], &context);
+
+    assert_that(cgreen_collector_wait(collector, 5000, ready, 4), is_equal_to(1));
+    assert_that(ready[0], is_equal_to(&context));
+    waitpid(child, NULL, 0);
+}
+
+Ensure(Collector, tells_nothing_while_processes_are_running) {
+    int go[2];
+    int exit_pipe[2];
+    int context;
+    void *ready[4];
+    pid_t child;
+
+    assert_that(pipe(go), is_equal_to(0));
+    child = start_process_waiting_for(go, exit_pipe);
+    cgreen_collector_watch_exit(collector, child, exit_pipe[0], &context);
+
+    assert_that(cgreen_collector_wait(collector, 0, ready, 4), is_equal_to(0));
+
+    close(go[0]);
+    close(go[1]);
+    assert_that(cgreen_collector_wait(collector, 5000, ready, 4), is_equal_to(1));
+    waitpid(child, NULL, 0);
+}
+
+Ensure(Collector, tells_when_there_is_something_to_read_from_a_channel) {
+    int channel[2];
+    int context;
+    void *ready[4];
+
+    assert_that(pipe(channel), is_equal_to(0));
+    cgreen_collector_watch_channel(collector, channel[0], &context);
+
+    assert_that(cgreen_collector_wait(collector, 0, ready, 4), is_equal_to(0));
+    assert_that(write(channel[1], "x", 1), is_equal_to(1));
+    assert_that(cgreen_collector_wait(collector, 5000, ready, 4), is_equal_to(1));
+    assert_that(ready[0], is_equal_to(&context));
+
+    cgreen_collector_forget(collector, &context);
+    close(channel[0]);
+    close(channel[1]);
+}
+
+Ensure(Collector, does_not_tell_about_forgotten_processes) {
+    int exit_pipe[2];
+    int context;
+    void *ready[4];
+    pid_t child = start_process(exit_pipe);
+
+    cgreen_collector_watch_exit(collector, child, exit_pipe[0], &context);
+    cgreen_collector_forget(collector, &context);
+
+    waitpid(child, NULL, 0);
+    assert_that(cgreen_collector_wait(collector, 0, ready, 4), is_equal_to(0));
+}
+
+Ensure(Collector, tells_about_all_of_many_processes) {
+    const int PROCESSES = 100;
+    int contexts[100];
+    pid_t children[100];
+    void *ready[16];
+    int exited = 0;
+    int i;
+
+    for (i = 0; i < PROCESSES; i++) {
+        int exit_pipe[2];
+        children[i] = start_process(exit_pipe);
+        contexts[i] = 0;
+        cgreen_collector_watch_exit(collector, children[i], exit_pipe[0], &contexts[i]);
+    }
+
+    while (exited < PROCESSES) {
+        int found = cgreen_collector_wait(collector, 5000, ready, 16);
+        if (found == 0)
+            break;
+        for (i = 0; i < found; i++) {
+            (*(int *)ready[i])++;
+            cgreen_collector_forget(collector, ready[i]);
+        }
+        exited += found;
+    }
+
+    assert_that(exited, is_equal_to(PROCESSES));
+    for (i = 0; i < PROCESSES; i++) {
+        assert_that(contexts[i], is_equal_to(1));
+        waitpid(children[i], NULL, 0);
+    }
+}
+#endif
+
+TestSuite *collector_tests(void) {
+    TestSuite *suite = create_test_suite();
+#ifndef WIN32
+    add_test_with_context(suite, Collector, tells_which_process_has_exited);
+    add_test_with_context(suite, Collector, tells_nothing_while_processes_are_running);
+    add_test_with_context(suite, Collector, tells_when_there_is_something_to_read_from_a_channel);
+    add_test_with_context(suite, Collector, does_not_tell_about_forgotten_processes);
+    add_test_with_context(suite, Collector, tells_about_all_of_many_processes);
+#endif
+    return suite;
+}
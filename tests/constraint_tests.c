@@ -2,6 +2,7 @@
 #include <cgreen/cgreen.h>
 #include <cgreen/constraint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef __cplusplus
 using namespace cgreen;
@@ -239,6 +240,97 @@ Ensure(Constraint, can_compare_to_hex) {
     assert_that((unsigned char)chars[0], is_equal_to_hex(0xaa));
 }
 
+static void assert_that_one_is_one(void) {
+    assert_that(1, is_equal_to(1));
+}
+
+static void assert_that_strings_are_equal(void) {
+    assert_that("a string", is_equal_to_string("a string"));
+}
+
+Ensure(Constraint, is_not_allocated_for_an_assertion) {
+    intptr_t allocations;
+
+    if (!allocations_can_be_counted())
+        return;
+
+    allocations = allocations_during(assert_that_one_is_one());
+    assert_that(allocations, is_equal_to(0));
+    allocations = allocations_during(assert_that_strings_are_equal());
+    assert_that(allocations, is_equal_to(0));
+}
+
+Ensure(Constraint, of_an_assertion_can_be_made_in_an_expression) {
+    int checked = 0;
+    int i;
+
+    for (i = 0; i < 2; assert_that(i, is_less_than(2)), i++)
+        checked++;
+    assert_that(checked, is_equal_to(2));
+}
+
+static Constraint *is_positive(void) {
+    return is_greater_than(0);
+}
+
+Ensure(Constraint, made_outside_of_an_assertion_is_allocated) {
+    Constraint *positive = is_positive();
+
+    assert_that(keep_constraint(positive) == positive);
+    assert_that(compare_integer_constraint(positive, 1), is_true);
+
+    destroy_constraint(positive);
+}
+
+Ensure(Constraint, made_before_the_assertion_using_it_lasts_until_then) {
+    Constraint *one = is_equal_to(1);
+
+    assert_that(1, one);
+}
+
+Ensure(Constraint, made_in_the_storage_of_an_assertion_is_copied_to_be_kept) {
+    Constraint storage;
+    Constraint *constraint;
+    Constraint *kept;
+
+    memset(&storage, 0, sizeof(storage));
+    constraint = create_equal_to_string_constraint_in(&storage, "expected", "name");
+    assert_that(constraint == &storage);
+
+    kept = keep_constraint(constraint);
+    assert_that(kept == &storage, is_false);
+    assert_that(kept->expected_value_name, is_equal_to_string("name"));
+    assert_that(kept->expected_value.value.string_value, is_equal_to_string("expected"));
+    assert_that(compare_string_constraint(kept, "expected"), is_true);
+
+    destroy_constraint(constraint);
+    destroy_constraint(kept);
+}
+
+Ensure(Constraint, is_allocated_when_the_storage_already_has_one) {
+    Constraint storage;
+    Constraint *first;
+    Constraint *second;
+
+    memset(&storage, 0, sizeof(storage));
+    first = create_equal_to_value_constraint_in(&storage, 1, "one");
+    second = create_equal_to_value_constraint_in(&storage, 2, "two");
+    assert_that(first == &storage);
+    assert_that(second == &storage, is_false);
+    assert_that(first->expected_value_name, is_equal_to_string("one"));
+
+    destroy_constraint(second);
+    destroy_constraint(first);
+}
+
+Ensure(Constraint, is_kept_as_it_is_when_allocated) {
+    Constraint *constraint = create_equal_to_value_constraint(1, "one");
+
+    assert_that(keep_constraint(constraint) == constraint);
+
+    destroy_constraint(constraint);
+}
+
 TestSuite *constraint_tests(void) {
     TestSuite *suite = create_test_suite();
     add_test_with_context(suite, Constraint, default_destroy_clears_state);
@@ -254,6 +346,13 @@ TestSuite *constraint_tests(void) {
     add_test_with_context(suite, Constraint, compare_equal_to_contents_is_false_on_null);
     add_test_with_context(suite, Constraint, compare_not_equal_to_contents_is_false_on_null);
     add_test_with_context(suite, Constraint, can_compare_to_hex);
+    add_test_with_context(suite, Constraint, is_not_allocated_for_an_assertion);
+    add_test_with_context(suite, Constraint, of_an_assertion_can_be_made_in_an_expression);
+    add_test_with_context(suite, Constraint, made_outside_of_an_assertion_is_allocated);
+    add_test_with_context(suite, Constraint, made_before_the_assertion_using_it_lasts_until_then);
+    add_test_with_context(suite, Constraint, made_in_the_storage_of_an_assertion_is_copied_to_be_kept);
+    add_test_with_context(suite, Constraint, is_allocated_when_the_storage_already_has_one);
+    add_test_with_context(suite, Constraint, is_kept_as_it_is_when_allocated);
 //    add_test_with_context(suite, Constraint, unequal_structs_with_same_value_for_specific_field_compare_true);
 
     return suite;
@@ -29,6 +29,13 @@ Ensure(FailureMessage, for_CGREEN_PER_TEST_TIMEOUT) {
     fail_test("This test should have been aborted within CGREEN_PER_TEST_TIMEOUT seconds and not get here. When running this test you need to define CGREEN_PER_TEST_TIMEOUT=2.");
 }
 
+// The passes are counted even though the test never gets to send them
+Ensure(FailureMessage, for_exiting_after_some_passes) {
+    assert_that(true);
+    assert_that(true);
+    _exit(EXIT_SUCCESS);
+}
+
 #ifdef __cplusplus
 Ensure(FailureMessage, increments_exception_count_when_throwing) {
     throw;
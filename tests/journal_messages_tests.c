@@ -0,0 +1,30 @@
+#include <cgreen/cgreen.h>
+
+#include <stdlib.h>
+
+#ifdef __cplusplus
+using namespace cgreen;
+#endif
+
+Describe(JournalMessage);
+BeforeEach(JournalMessage) {}
+AfterEach(JournalMessage) {}
+
+Ensure(JournalMessage, for_a_completed_test) {
+    assert_that(true);
+}
+
+Ensure(JournalMessage, for_a_failed_assertion) {
+    assert_that(1, is_equal_to(2));
+}
+
+// The journal tells where the last assertion was, since the test never finishes
+Ensure(JournalMessage, for_a_test_that_crashes_after_some_passes) {
+    assert_that(true);
+    assert_that(true);
+    abort();
+}
+
+xEnsure(JournalMessage, for_a_skipped_test) {
+    fail_test("This test should have been skipped.");
+}
@@ -0,0 +1,122 @@
+#include <cgreen/cgreen.h>
+
+#ifndef WIN32
+#include <cgreen/internal/cgreen_journal.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#ifdef __cplusplus
+using namespace cgreen;
+#endif
+
+#ifndef WIN32
+#define RECORDS 4
+#define JOURNAL_SIZE ((RECORDS + 1) * CGREEN_JOURNAL_RECORD_SIZE)
+
+static char filename[] = "/tmp/cgreen_journal_XXXXXX";
+static CgreenJournalHeader *journal;
+
+Describe(Journal);
+BeforeEach(Journal) {
+    int fd = mkstemp(filename);
+
+    journal = NULL;
+    assert_that(fd, is_not_equal_to(-1));
+    if (fd < 0)
+        return;
+    close(fd);
+    journal = cgreen_journal_map(filename, JOURNAL_SIZE);
+    assert_that(journal, is_not_null);
+    if (journal == NULL)
+        return;
+    journal->record_size = CGREEN_JOURNAL_RECORD_SIZE;
+    journal->capacity = RECORDS;
+}
+AfterEach(Journal) {
+    if (journal != NULL)
+        munmap(journal, JOURNAL_SIZE);
+    unlink(filename);
+    strcpy(filename, "/tmp/cgreen_journal_XXXXXX");
+}
+
+Ensure(Journal, records_are_the_size_of_a_record) {
+    assert_that(sizeof(CgreenJournalRecord), is_equal_to(CGREEN_JOURNAL_RECORD_SIZE));
+}
+
+Ensure(Journal, reserves_records_one_after_another) {
+    CgreenJournalRecord *first = cgreen_journal_reserve(journal);
+    CgreenJournalRecord *second = cgreen_journal_reserve(journal);
+
+    assert_that((char *)second - (char *)first, is_equal_to(CGREEN_JOURNAL_RECORD_SIZE));
+    assert_that(journal->tail, is_equal_to(2));
+}
+
+Ensure(Journal, counts_the_records_that_did_not_fit) {
+    int i;
+
+    for (i = 0; i < RECORDS; i++)
+        assert_that(cgreen_journal_reserve(journal), is_not_null);
+    assert_that(cgreen_journal_reserve(journal), is_null);
+    assert_that(journal->tail, is_equal_to(RECORDS + 1));
+}
+
+Ensure(Journal, tells_that_a_reserved_record_is_unwritten_until_it_is_published) {
+    CgreenJournalRecord *record = cgreen_journal_reserve(journal);
+
+    assert_that(record->type, is_equal_to(CGREEN_JOURNAL_UNWRITTEN));
+    cgreen_journal_publish(record, CGREEN_JOURNAL_FAILURE);
+    assert_that(record->type, is_equal_to(CGREEN_JOURNAL_FAILURE));
+}
+
+Ensure(Journal, keeps_what_a_process_wrote_before_it_crashed) {
+    CgreenJournalRecord *record;
+    pid_t child = fork();
+
+    if (child == 0) {
+        record = cgreen_journal_reserve(journal);
+        strcpy(record->name, "crashing");
+        record->last_line = 42;
+        cgreen_journal_publish(record, CGREEN_JOURNAL_TEST);
+        signal(SIGABRT, SIG_DFL);
+        abort();
+    }
+    waitpid(child, NULL, 0);
+
+    assert_that(journal->tail, is_equal_to(1));
+    record = (CgreenJournalRecord *)((char *)journal + CGREEN_JOURNAL_RECORD_SIZE);
+    assert_that(record->type, is_equal_to(CGREEN_JOURNAL_TEST));
+    assert_that(record->name, is_equal_to_string("crashing"));
+    assert_that(record->last_line, is_equal_to(42));
+}
+
+Ensure(Journal, can_not_be_printed_from_a_file_that_is_not_a_journal) {
+    FILE *file = fopen(filename, "w");
+
+    assert_that(file, is_not_null);
+    if (file == NULL)
+        return;
+    fputs("not a journal", file);
+    fclose(file);
+
+    assert_that(print_journal(filename), is_equal_to(0));
+}
+#endif
+
+TestSuite *journal_tests(void) {
+    TestSuite *suite = create_test_suite();
+#ifndef WIN32
+    add_test_with_context(suite, Journal, records_are_the_size_of_a_record);
+    add_test_with_context(suite, Journal, reserves_records_one_after_another);
+    add_test_with_context(suite, Journal, counts_the_records_that_did_not_fit);
+    add_test_with_context(suite, Journal, tells_that_a_reserved_record_is_unwritten_until_it_is_published);
+    add_test_with_context(suite, Journal, keeps_what_a_process_wrote_before_it_crashed);
+    add_test_with_context(suite, Journal, can_not_be_printed_from_a_file_that_is_not_a_journal);
+#endif
+    return suite;
+}
@@ -1,6 +1,7 @@
 #include <cgreen/cgreen.h>
 #include <cgreen/message_formatting.h>
 #include <stdlib.h>
+#include <string.h>
 #include "src/constraint_internal.h"
 
 #ifdef __cplusplus
@@ -43,11 +44,62 @@ Ensure(MessageFormatting, shows_offset_as_zero_based) {
 
     constraint->destroy(constraint);
     free(failure_message);
-    destroy_constraint(constraint);
+}
+
+Ensure(MessageFormatting, builds_failure_message_in_this_test_without_doubling_percent_signs) {
+    Constraint *constraint =
+        create_equal_to_string_constraint("This contains %!", "string_with_percent");
+
+    const char *failure_message = failure_message_in_this_test_for(constraint, "actual_string",
+                                                                   (intptr_t)"This contains another %!");
+    assert_that(failure_message, contains_string("contains %!"));
+    assert_that(failure_message, contains_string("another %!"));
+
+    constraint->destroy(constraint);
+}
+
+Ensure(MessageFormatting, keeps_failure_messages_of_this_test_until_forgotten) {
+    char long_string[10000];
+    Constraint *constraint = create_equal_to_value_constraint(1, "one");
+    Constraint *long_constraint;
+    const char *first_message;
+    const char *long_message;
+
+    memset(long_string, 'x', sizeof(long_string) - 1);
+    long_string[sizeof(long_string) - 1] = '\0';
+    long_constraint = create_equal_to_string_constraint(long_string, "long_string");
+
+    first_message = failure_message_in_this_test_for(constraint, "two", 2);
+    long_message = failure_message_in_this_test_for(long_constraint, "other", (intptr_t)"other");
+
+    assert_that(first_message, begins_with_string("Expected [two] to [equal] [one]"));
+    assert_that(long_message, contains_string(long_string));
+
+    forget_failure_messages_of_this_test();
+    assert_that(failure_message_in_this_test_for(constraint, "three", 3),
+                begins_with_string("Expected [three] to [equal] [one]"));
+
+    constraint->destroy(constraint);
+    long_constraint->destroy(long_constraint);
+}
+
+Ensure(MessageFormatting, does_not_build_a_message_to_check_that_parameters_are_valid) {
+    char area[4] = {0};
+    Constraint *constraint = create_equal_to_contents_constraint(area, sizeof(area), "area");
+
+    assert_that(parameters_are_not_valid_for(constraint, (intptr_t)area), is_false);
+    assert_that(parameters_are_not_valid_for(constraint, (intptr_t)NULL), is_true);
+    assert_that(allocations_during(parameters_are_not_valid_for(constraint, (intptr_t)area)),
+                is_equal_to(0));
+
+    constraint->destroy(constraint);
 }
 
 TestSuite *message_formatting_tests(void) {
     TestSuite *suite = create_test_suite();
     add_test_with_context(suite, MessageFormatting, can_show_failure_message_containing_percent_sign);
+    add_test_with_context(suite, MessageFormatting, builds_failure_message_in_this_test_without_doubling_percent_signs);
+    add_test_with_context(suite, MessageFormatting, keeps_failure_messages_of_this_test_until_forgotten);
+    add_test_with_context(suite, MessageFormatting, does_not_build_a_message_to_check_that_parameters_are_valid);
     return suite;
 }
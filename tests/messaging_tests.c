@@ -6,6 +6,11 @@
 #include "../src/utils.h"
 
 #include <signal.h>
+#ifndef WIN32
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 #ifdef __cplusplus
 using namespace cgreen;
@@ -33,6 +38,213 @@ Ensure(can_send_message) {
     assert_that(receive_cgreen_message(messaging), is_equal_to(99));
 }
 
+Ensure(can_send_message_with_payload) {
+    int messaging = start_cgreen_messaging(33);
+    void *payload;
+    size_t size;
+    send_cgreen_message_with_payload(messaging, 99, "payload", 8);
+    assert_that(receive_cgreen_message_with_payload(messaging, &payload, &size), is_equal_to(99));
+    assert_that((const char *)payload, is_equal_to_string("payload"));
+    assert_that(size, is_equal_to(8));
+    free(payload);
+}
+
+Ensure(payload_is_skipped_when_receiving_without_it) {
+    int messaging = start_cgreen_messaging(33);
+    send_cgreen_message_with_payload(messaging, 99, "payload", 8);
+    send_cgreen_message(messaging, 98);
+    assert_that(receive_cgreen_message(messaging), is_equal_to(99));
+    assert_that(receive_cgreen_message(messaging), is_equal_to(98));
+}
+
+#ifndef WIN32
+/* More than fits in the ring, but not so many that the rest doesn't
+   fit in the pipe */
+Ensure(messages_overflowing_into_the_pipe_are_received_in_order) {
+    const int MESSAGES = 12000;
+    int messaging = start_cgreen_messaging(33);
+    int i;
+
+    for (i = 1; i <= MESSAGES; i++)
+        send_cgreen_message(messaging, i);
+    for (i = 1; i <= MESSAGES; i++)
+        if (receive_cgreen_message(messaging) != i)
+            break;
+    assert_that(i, is_equal_to(MESSAGES + 1));
+    assert_that(receive_cgreen_message(messaging), is_equal_to(0));
+}
+
+Ensure(messages_can_be_received_after_the_sender_has_crashed) {
+    int messaging = start_cgreen_messaging(33);
+    void *payload;
+    int status;
+    pid_t child = fork();
+
+    if (child == 0) {
+        send_cgreen_message(messaging, 98);
+        send_cgreen_message_with_payload(messaging, 99, "payload", 8);
+        abort();
+    }
+    waitpid(child, &status, 0);
+
+    assert_that(WIFSIGNALED(status));
+    assert_that(receive_cgreen_message(messaging), is_equal_to(98));
+    assert_that(receive_cgreen_message_with_payload(messaging, &payload, NULL), is_equal_to(99));
+    assert_that((const char *)payload, is_equal_to_string("payload"));
+    free(payload);
+}
+
+static int receive_messages_in_order(int messaging, int next) {
+    int received;
+
+    while ((received = receive_cgreen_message(messaging)) > 0)
+        if (received == next)
+            next++;
+    return next;
+}
+
+/* Far more than fits in both the ring and the pipe */
+Ensure(messages_from_another_process_are_not_limited_when_drained_while_it_sends) {
+    const int MESSAGES = 200000;
+    int messaging = start_cgreen_messaging(33);
+    struct pollfd wakeup;
+    int next = 1;
+    int status;
+    pid_t child = fork();
+
+    if (child == 0) {
+        int i;
+        for (i = 1; i <= MESSAGES; i++)
+            send_cgreen_message(messaging, i);
+        _exit(0);
+    }
+
+    wakeup.fd = get_cgreen_messaging_wakeup(messaging);
+    wakeup.events = POLLIN;
+    while (waitpid(child, &status, WNOHANG) == 0) {
+        if (poll(&wakeup, 1, 10) > 0) {
+            clear_cgreen_messaging_wakeup(messaging);
+            next = receive_messages_in_order(messaging, next);
+        }
+    }
+    next = receive_messages_in_order(messaging, next);
+
+    assert_that(WIFEXITED(status));
+    assert_that(next, is_equal_to(MESSAGES + 1));
+}
+
+static int next_drained;
+
+static void receive_drained_in_order(void *messaging) {
+    next_drained = receive_messages_in_order(*(int *)messaging, next_drained);
+}
+
+/* Far more than fits in both the ring and the pipe */
+Ensure(messages_are_not_limited_in_the_process_that_drains_them_itself) {
+    const int MESSAGES = 200000;
+    int messaging = start_cgreen_messaging(33);
+    int i;
+
+    next_drained = 1;
+    drain_cgreen_messaging_with(messaging, &receive_drained_in_order, &messaging);
+    for (i = 1; i <= MESSAGES; i++)
+        send_cgreen_message(messaging, i);
+    receive_drained_in_order(&messaging);
+
+    assert_that(next_drained, is_equal_to(MESSAGES + 1));
+}
+
+#define LARGE_PAYLOAD_SIZE (1024*1024)
+
+static char *create_large_payload(void) {
+    char *payload = (char *)malloc(LARGE_PAYLOAD_SIZE);
+    int i;
+
+    for (i = 0; i < LARGE_PAYLOAD_SIZE; i++)
+        payload[i] = (char)(i % 251);
+    return payload;
+}
+
+static void *large_payload_received;
+static size_t size_received;
+
+static void receive_large_payload(void *messaging) {
+    void *payload;
+    size_t size;
+
+    while (receive_cgreen_message_with_payload(*(int *)messaging, &payload, &size) > 0) {
+        free(large_payload_received);
+        large_payload_received = payload;
+        size_received = size;
+    }
+}
+
+Ensure(messages_larger_than_the_ring_are_received_whole_in_the_process_that_drains_them) {
+    int messaging = start_cgreen_messaging(33);
+    char *payload = create_large_payload();
+
+    large_payload_received = NULL;
+    drain_cgreen_messaging_with(messaging, &receive_large_payload, &messaging);
+    send_cgreen_message_with_payload(messaging, 99, payload, LARGE_PAYLOAD_SIZE);
+    receive_large_payload(&messaging);
+
+    assert_that(size_received, is_equal_to(LARGE_PAYLOAD_SIZE));
+    assert_that(large_payload_received, is_equal_to_contents_of(payload, LARGE_PAYLOAD_SIZE));
+    free(large_payload_received);
+    free(payload);
+}
+
+Ensure(messages_larger_than_the_ring_from_another_process_are_received_whole) {
+    int messaging = start_cgreen_messaging(33);
+    char *payload = create_large_payload();
+    struct pollfd wakeup;
+    int status;
+    pid_t child = fork();
+
+    if (child == 0) {
+        send_cgreen_message_with_payload(messaging, 99, payload, LARGE_PAYLOAD_SIZE);
+        _exit(0);
+    }
+
+    large_payload_received = NULL;
+    wakeup.fd = get_cgreen_messaging_wakeup(messaging);
+    wakeup.events = POLLIN;
+    while (waitpid(child, &status, WNOHANG) == 0) {
+        if (poll(&wakeup, 1, 10) > 0) {
+            clear_cgreen_messaging_wakeup(messaging);
+            receive_large_payload(&messaging);
+        }
+    }
+    receive_large_payload(&messaging);
+
+    assert_that(WIFEXITED(status));
+    assert_that(size_received, is_equal_to(LARGE_PAYLOAD_SIZE));
+    assert_that(large_payload_received, is_equal_to_contents_of(payload, LARGE_PAYLOAD_SIZE));
+    free(large_payload_received);
+    free(payload);
+}
+
+/* As when tests are not run in processes of their own, far more
+   results than fit in both the ring and the pipe */
+Ensure(results_are_not_limited_when_read_by_the_process_that_sends_them) {
+    const int RESULTS = 100000;
+    TestReporter *reporter = create_reporter();
+    int i;
+
+    reporter->ipc = start_cgreen_messaging(33);
+    reporter->summarize_passes = 0;
+    drain_reporter_results_in_this_process(reporter);
+    for (i = 0; i < RESULTS; i++)
+        add_reporter_result(reporter, true);
+    send_reporter_completion_notification(reporter);
+    drain_reporter_results(reporter);
+
+    assert_that(reporter->passes, is_equal_to(RESULTS));
+    drain_cgreen_messaging_with(reporter->ipc, NULL, NULL);
+    destroy_reporter(reporter);
+}
+#endif
+
 static int signal_received = 0;
 static void catch_signal(int s) {
     (void)s;
@@ -66,6 +278,17 @@ TestSuite *messaging_tests(void) {
     TestSuite *suite = create_test_suite();
     add_suite(suite, highly_nested_test_suite());
     add_test(suite, can_send_message);
+    add_test(suite, can_send_message_with_payload);
+    add_test(suite, payload_is_skipped_when_receiving_without_it);
+#ifndef WIN32
+    add_test(suite, messages_overflowing_into_the_pipe_are_received_in_order);
+    add_test(suite, messages_can_be_received_after_the_sender_has_crashed);
+    add_test(suite, messages_from_another_process_are_not_limited_when_drained_while_it_sends);
+    add_test(suite, messages_are_not_limited_in_the_process_that_drains_them_itself);
+    add_test(suite, messages_larger_than_the_ring_are_received_whole_in_the_process_that_drains_them);
+    add_test(suite, messages_larger_than_the_ring_from_another_process_are_received_whole);
+    add_test(suite, results_are_not_limited_when_read_by_the_process_that_sends_them);
+#endif
 #ifndef WIN32 // TODO: win32 needs non-blocking pipes like posix for this to pass
     add_test(suite, failure_reported_and_exception_thrown_when_messaging_would_block);
 #endif
@@ -3,6 +3,9 @@
 #include <cgreen/mocks.h>
 #include <cgreen/unit.h>
 #include <stdlib.h>
+#ifndef WIN32
+#include <pthread.h>
+#endif
 
 #ifdef __cplusplus
 using namespace cgreen;
@@ -193,3 +196,44 @@ Ensure(Mocks, constraint_number_of_calls_out_of_order_expectations_fail) {
     simple_mocked_function(2, 2);
     simple_mocked_function(1, 2);
 }
+
+#ifndef WIN32
+static void threaded_in(int i) {
+    mock(i);
+}
+
+static void *call_threaded_in_from_thread(void *i) {
+    threaded_in((int)(intptr_t)i);
+    return NULL;
+}
+
+/* The failures are shown in the same order however the threads run */
+Ensure(Mocks, failures_in_threads_are_shown_in_order) {
+    pthread_t threads[4];
+    intptr_t i;
+
+    cgreen_test_uses_threads();
+    always_expect(threaded_in, when(i, is_equal_to(1)));
+    for (i = 3; i >= 0; i--)
+        pthread_create(&threads[i], NULL, &call_threaded_in_from_thread, (void *)i);
+    for (i = 0; i < 4; i++)
+        pthread_join(threads[i], NULL);
+}
+
+static void *assert_from_thread(void *i) {
+    assert_that((int)(intptr_t)i, is_equal_to(1));
+    return NULL;
+}
+
+Ensure(Mocks, failed_assertions_in_threads_are_shown_in_order) {
+    pthread_t threads[4];
+    intptr_t i;
+
+    cgreen_test_uses_threads();
+    for (i = 3; i >= 0; i--)
+        pthread_create(&threads[i], NULL, &assert_from_thread, (void *)i);
+    assert_that(4, is_equal_to(1));
+    for (i = 0; i < 4; i++)
+        pthread_join(threads[i], NULL);
+}
+#endif
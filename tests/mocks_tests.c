@@ -2,7 +2,13 @@
 #include <cgreen/cgreen.h>
 #include <cgreen/mocks.h>
 #include <cgreen/unit.h>
+#include <stdio.h>
 #include <stdlib.h>
+#ifndef WIN32
+#include <pthread.h>
+#endif
+
+#include "../src/parameters.h"
 
 #ifdef __cplusplus
 using namespace cgreen;
@@ -177,6 +183,40 @@ Ensure(Mocks, can_always_return_double) {
     assert_that_double(double_out(), is_equal_to_double(4.23));
     assert_that_double(double_out(), is_equal_to_double(4.23));
 }
+
+static double halved(double d) {
+    return mock_double(box_double(d));
+}
+
+Ensure(Mocks, can_return_double_without_unboxing) {
+    expect(halved, when(d, is_equal_to_double(5.0)), will_return_double(2.5));
+    assert_that_double(halved(5.0), is_equal_to_double(2.5));
+}
+
+Ensure(Mocks, converts_an_integer_return_to_double_for_mock_double) {
+    expect(halved, will_return(2));
+    assert_that_double(halved(4.0), is_equal_to_double(2.0));
+}
+
+static void call_halved_ten_times(void) {
+    int i;
+
+    for (i = 0; i < 10; i++)
+        halved(5.0);
+}
+
+Ensure(Mocks, do_not_allocate_when_passing_and_returning_doubles) {
+    if (!allocations_can_be_counted() || sizeof(intptr_t) < sizeof(double))
+        return;
+    always_expect(halved, when(d, is_equal_to_double(5.0)), will_return_double(2.5));
+    always_expect(double_out, will_return_double(4.23));
+
+    halved(5.0);
+    double_out();
+    assert_that(allocations_during(call_halved_ten_times()), is_equal_to(0));
+    assert_that(allocations_during(unbox_double(box_double(4.23))), is_equal_to(0));
+    assert_that(allocations_during(double_out()), is_equal_to(0));
+}
 #endif
 
 
@@ -400,6 +440,136 @@ Ensure(Mocks, mock_expect_with_side_effect) {
     assert_that(sideeffect_changed, is_equal_to(2));
 }
 
+Ensure(Mocks, keeps_the_expectations_of_each_function_in_order) {
+    expect(integer_out, will_return(1));
+    expect(string_out, will_return("first"));
+    expect(integer_out, will_return(2));
+    expect(string_out, will_return("second"));
+
+    assert_that(string_out(1), is_equal_to_string("first"));
+    assert_that(string_out(2), is_equal_to_string("second"));
+    assert_that(integer_out(), is_equal_to(1));
+    assert_that(integer_out(), is_equal_to(2));
+}
+
+Ensure(Mocks, finds_the_expectations_of_each_of_many_mocked_functions) {
+    static char names[200][32];
+    int i;
+
+    for (i = 0; i < 200; i++) {
+        snprintf(names[i], sizeof(names[i]), "mocked_function_%d", i);
+        expect_(get_test_reporter(), names[i], __FILE__, __LINE__, will_return(i), (Constraint *)0);
+        expect_(get_test_reporter(), names[i], __FILE__, __LINE__, will_return(-i), (Constraint *)0);
+    }
+
+    for (i = 199; i >= 0; i--) {
+        assert_that(mock_(get_test_reporter(), names[i], __FILE__, __LINE__, ""), is_equal_to(i));
+    }
+    for (i = 0; i < 200; i++) {
+        assert_that(mock_(get_test_reporter(), names[i], __FILE__, __LINE__, ""), is_equal_to(-i));
+    }
+}
+
+Ensure(Mocks, parses_the_parameters_of_each_call_site_only_once) {
+    int i;
+
+    always_expect(sample_mock, when(i, is_less_than(1000)), when(s, is_equal_to_string("devil")),
+                  will_return(5));
+    always_expect(double_in, when(d, is_equal_to_double(3.14)));
+
+    for (i = 0; i < 100; i++) {
+        assert_that(sample_mock(i, "devil"), is_equal_to(5));
+        double_in(3.14);
+    }
+    assert_that(number_of_parsed_parameter_lists(), is_equal_to(2));
+}
+
+static void call_sample_mock_ten_times(void) {
+    int i;
+
+    for (i = 0; i < 10; i++)
+        sample_mock(i, "devil");
+}
+
+Ensure(Mocks, do_not_allocate_when_called_with_a_handful_of_parameters) {
+    if (!allocations_can_be_counted())
+        return;
+    always_expect(sample_mock, when(i, is_less_than(10)), will_return(5));
+
+    sample_mock(0, "devil");
+    assert_that(allocations_during(call_sample_mock_ten_times()), is_equal_to(0));
+}
+
+Ensure(Mocks, counts_the_calls_to_each_mocked_function) {
+    cgreen_mocks_are(loose_mocks);
+    expect(integer_out, will_return(1));
+
+    assert_that(number_of_calls_to(integer_out), is_equal_to(0));
+    integer_out();
+    integer_out();
+    integer_in(3);
+    assert_that(number_of_calls_to(integer_out), is_equal_to(2));
+    assert_that(number_of_calls_to(integer_in), is_equal_to(1));
+    assert_that(number_of_calls_to(string_out), is_equal_to(0));
+}
+
+static void call_integer_out_a_thousand_times(void) {
+    int i;
+
+    for (i = 0; i < 1000; i++)
+        integer_out();
+}
+
+Ensure(Mocks, count_many_calls_without_allocating) {
+    always_expect(integer_out, will_return(1));
+
+    integer_out();
+    if (allocations_can_be_counted())
+        assert_that(allocations_during(call_integer_out_a_thousand_times()), is_equal_to(0));
+    else
+        call_integer_out_a_thousand_times();
+    assert_that(number_of_calls_to(integer_out), is_equal_to(1001));
+}
+
+#ifndef WIN32
+#define THREADS 4
+#define CALLS_FROM_EACH_THREAD 1000
+
+static void *call_sample_mock_from_thread(void *unused) {
+    int i;
+
+    (void)unused;
+    for (i = 0; i < CALLS_FROM_EACH_THREAD; i++)
+        assert_that(sample_mock(i, "devil"), is_equal_to(5));
+    return NULL;
+}
+
+static void call_sample_mock_from_threads(void) {
+    pthread_t threads[THREADS];
+    int t;
+
+    for (t = 0; t < THREADS; t++)
+        pthread_create(&threads[t], NULL, &call_sample_mock_from_thread, NULL);
+    for (t = 0; t < THREADS; t++)
+        pthread_join(threads[t], NULL);
+}
+
+Ensure(Mocks, can_be_called_from_threads) {
+    cgreen_test_uses_threads();
+    always_expect(sample_mock, when(i, is_less_than(CALLS_FROM_EACH_THREAD)),
+                  when(s, is_equal_to_string("devil")), will_return(5));
+
+    call_sample_mock_from_threads();
+    assert_that(number_of_calls_to(sample_mock), is_equal_to(THREADS * CALLS_FROM_EACH_THREAD));
+}
+
+Ensure(Mocks, expectations_are_used_up_exactly_by_calls_from_threads) {
+    cgreen_test_uses_threads();
+    expect(sample_mock, will_return(5), times(THREADS * CALLS_FROM_EACH_THREAD));
+
+    call_sample_mock_from_threads();
+}
+#endif
 
 TestSuite *mock_tests(void) {
     TestSuite *suite = create_test_suite();
@@ -410,6 +580,21 @@ TestSuite *mock_tests(void) {
     add_test_with_context(suite, Mocks, expectations_are_reset_between_tests_with_loose_mocks);
     add_test_with_context(suite, Mocks, can_stub_a_string_return);
     add_test_with_context(suite, Mocks, can_stub_a_string_sequence);
+    add_test_with_context(suite, Mocks, keeps_the_expectations_of_each_function_in_order);
+    add_test_with_context(suite, Mocks, finds_the_expectations_of_each_of_many_mocked_functions);
+    add_test_with_context(suite, Mocks, parses_the_parameters_of_each_call_site_only_once);
+    add_test_with_context(suite, Mocks, do_not_allocate_when_called_with_a_handful_of_parameters);
+    add_test_with_context(suite, Mocks, counts_the_calls_to_each_mocked_function);
+    add_test_with_context(suite, Mocks, count_many_calls_without_allocating);
+#ifndef WIN32
+    add_test_with_context(suite, Mocks, can_be_called_from_threads);
+    add_test_with_context(suite, Mocks, expectations_are_used_up_exactly_by_calls_from_threads);
+#endif
+#ifndef __cplusplus
+    add_test_with_context(suite, Mocks, can_return_double_without_unboxing);
+    add_test_with_context(suite, Mocks, converts_an_integer_return_to_double_for_mock_double);
+    add_test_with_context(suite, Mocks, do_not_allocate_when_passing_and_returning_doubles);
+#endif
     add_test_with_context(suite, Mocks, expecting_once_with_any_parameters);
     add_test_with_context(suite, Mocks, expecting_once_with_parameter_checks_that_parameter);
     add_test_with_context(suite, Mocks, always_expect_keeps_affirming_parameter);
@@ -1,5 +1,6 @@
 #include <cgreen/cgreen.h>
 #include <cgreen/vector.h>
+#include <stdio.h>
 #include <stdlib.h>
 
 #include "../src/parameters.h"
@@ -11,7 +12,8 @@ using namespace cgreen;
 static CgreenVector *names = NULL;
 
 void destroy_names(void) {
-    destroy_cgreen_vector(names);
+    if (names != NULL)
+        destroy_cgreen_vector(names);
     names = NULL;
 }
 
@@ -153,6 +155,36 @@ Ensure(can_create_markers_for_mixed_parameters) {
     destroy_cgreen_vector(markers);
 }
 
+Ensure(parses_a_parameter_list_the_first_time_it_is_seen) {
+    const char *parameters = "a, box_double(b)";
+    const ParameterList *list = parameter_list_for(parameters);
+
+    assert_that(list->count, is_equal_to(2));
+    assert_that((const char *)cgreen_vector_get(list->names, 1), is_equal_to_string("b"));
+    assert_that(*(bool*)cgreen_vector_get(list->double_markers, 1));
+    assert_that(parameter_list_for(parameters), is_equal_to(list));
+    assert_that(number_of_parsed_parameter_lists(), is_equal_to(1));
+    forget_parameter_lists();
+}
+
+Ensure(keeps_many_parsed_parameter_lists_apart) {
+    static char parameters[500][16];
+    int i;
+
+    for (i = 0; i < 500; i++) {
+        sprintf(parameters[i], "a%d", i);
+        parameter_list_for(parameters[i]);
+    }
+    for (i = 0; i < 500; i++) {
+        const ParameterList *list = parameter_list_for(parameters[i]);
+        assert_that(list->parameters, is_equal_to(parameters[i]));
+        assert_that((const char *)cgreen_vector_get(list->names, 0), is_equal_to_string(parameters[i]));
+    }
+    assert_that(number_of_parsed_parameter_lists(), is_equal_to(500));
+    forget_parameter_lists();
+    assert_that(number_of_parsed_parameter_lists(), is_equal_to(0));
+}
+
 TestSuite *parameter_tests(void) {
     TestSuite *suite = create_test_suite();
     set_teardown(suite, destroy_names);
@@ -171,5 +203,7 @@ TestSuite *parameter_tests(void) {
     add_test(suite, can_strip_d_macro_and_box_double_to_leave_original_names);
     add_test(suite, can_strip_box_double_and_d_macro_to_leave_original_names);
     add_test(suite, can_strip_multiple_mixed_parameters_to_leave_original_names);
+    add_test(suite, parses_a_parameter_list_the_first_time_it_is_seen);
+    add_test(suite, keeps_many_parsed_parameter_lists_apart);
     return suite;
 }
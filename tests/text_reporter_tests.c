@@ -12,6 +12,8 @@ using namespace cgreen;
 
 #include <cgreen/text_reporter.h>
 #include "src/text_reporter_internal.h"
+#include "src/cgreen_value_internal.h"
+#include "src/constraint_internal.h"
 
 
 
@@ -116,6 +118,231 @@ Ensure(TextReporter, will_report_passed_for_test_with_one_pass_on_completion) {
     assert_that(output, contains_string("Completed \"suite_name\": 1 pass"));
 }
 
+Ensure(TextReporter, will_count_passes_without_sending_each_of_them) {
+    int i;
+
+    reporter->start_suite(reporter, "suite_name", 1);
+    reporter->start_test(reporter, "test_name");
+
+    for (i = 0; i < 1000; i++)
+        (*reporter->assert_true)(reporter, "file", 2, true, "");
+    assert_that(receive_cgreen_message(reporter->ipc), is_equal_to(0));
+
+    send_reporter_completion_notification(reporter);
+    reporter->finish_test(reporter, "filename", line, NULL);
+    reporter->finish_suite(reporter, "filename", line);
+
+    assert_that(output, contains_string("Completed \"suite_name\": 1000 passes"));
+}
+
+Ensure(TextReporter, will_count_passes_before_and_after_a_failure) {
+    reporter->start_suite(reporter, "suite_name", 1);
+    reporter->start_test(reporter, "test_name");
+
+    (*reporter->assert_true)(reporter, "file", 2, true, "");
+    (*reporter->assert_true)(reporter, "file", 3, false, "");
+    (*reporter->assert_true)(reporter, "file", 4, true, "");
+    (*reporter->assert_true)(reporter, "file", 5, true, "");
+
+    send_reporter_completion_notification(reporter);
+    reporter->finish_test(reporter, "filename", line, NULL);
+    reporter->finish_suite(reporter, "filename", line);
+
+    assert_that(output, contains_string("Completed \"suite_name\": 3 passes, 1 failure"));
+}
+
+Ensure(TextReporter, will_show_failures_sent_from_a_test_process) {
+    TestReporter *test_process = create_reporter();
+
+    test_process->ipc = reporter->ipc;
+    defer_reporter_output(test_process);
+
+    reporter->start_suite(reporter, "suite_name", 1);
+    reporter->start_test(reporter, "test_name");
+
+    (*test_process->assert_true)(test_process, "file", 3, false, "failure message %d", 42);
+    send_reporter_completion_notification(test_process);
+    reporter->finish_test(reporter, "filename", line, NULL);
+    reporter->finish_suite(reporter, "filename", line);
+    destroy_reporter(test_process);
+
+    assert_that(output, contains_string("file:3: Failure: test_name"));
+    assert_that(output, contains_string("failure message 42"));
+    assert_that(output, contains_string("1 failure"));
+}
+
+static CgreenEvent reported;
+static const char *message_when_reported;
+
+static void remember_event(TestReporter *reporter, CgreenEvent *event) {
+    (void)reporter;
+    reported = *event;
+    message_when_reported = event->message;
+    reported.message = strdup(cgreen_event_message(event));
+}
+
+static void show_fail_of_first_version(TestReporter *reporter, const char *file, int line,
+                                       const char *message, va_list arguments) {
+    char formatted[100];
+    (void)reporter;
+    vsnprintf(formatted, sizeof(formatted), message, arguments);
+    output = concat(output, formatted);
+    snprintf(formatted, sizeof(formatted), " at %s:%d", file, line);
+    output = concat(output, formatted);
+}
+
+Ensure(TextReporter, will_give_failures_to_reporters_as_events) {
+    reporter->report_fail = &remember_event;
+    reporter->start_test(reporter, "test_name");
+
+    (*reporter->assert_true)(reporter, "file", 2, false, "%d apples", 3);
+
+    assert_that(reported.file, is_equal_to_string("file"));
+    assert_that(reported.line, is_equal_to(2));
+    assert_that(reported.message, is_equal_to_string("3 apples"));
+    free((void *)reported.message);
+}
+
+Ensure(TextReporter, will_not_format_the_message_of_an_event_until_asked_for) {
+    reporter->report_pass = &remember_event;
+    reporter->start_test(reporter, "test_name");
+
+    (*reporter->assert_true)(reporter, "file", 2, true, "%s", "a pass");
+
+    assert_that(message_when_reported, is_null);
+    assert_that(reported.message, is_equal_to_string("a pass"));
+    free((void *)reported.message);
+}
+
+Ensure(TextReporter, will_tell_what_is_known_about_an_assertion_in_its_event) {
+    CgreenEvent event;
+
+    reporter->report_fail = &remember_event;
+    reporter->start_test(reporter, "test_name");
+
+    memset(&event, 0, sizeof(event));
+    event.file = "file";
+    event.line = 2;
+    event.constraint = "equal";
+    event.expression = "apples";
+    event.expected = "pears";
+    reporter_show_assertion(reporter, false, &event, "Expected [%s] to [%s] [%s]", "apples", "equal", "pears");
+
+    assert_that(reported.constraint, is_equal_to_string("equal"));
+    assert_that(reported.expression, is_equal_to_string("apples"));
+    assert_that(reported.expected, is_equal_to_string("pears"));
+    assert_that(reported.message, is_equal_to_string("Expected [apples] to [equal] [pears]"));
+    free((void *)reported.message);
+}
+
+static char expression_when_reported[100];
+
+static void remember_expression(TestReporter *reporter, CgreenEvent *event) {
+    (void)reporter;
+    snprintf(expression_when_reported, sizeof(expression_when_reported), "%s", event->expression);
+}
+
+Ensure(TextReporter, will_tell_the_same_expression_for_a_passing_and_a_failing_parameter) {
+    Constraint *constraint = create_equal_to_value_constraint(3, "3");
+
+    constraint->parameter_name = "apples";
+    reporter->report_pass = &remember_expression;
+    reporter->report_fail = &remember_expression;
+    reporter->start_test(reporter, "test_name");
+
+    test_want(constraint, "basket", make_cgreen_integer_value(3), "file", 2, reporter);
+    assert_that(expression_when_reported, is_equal_to_string("[apples] parameter in [basket]"));
+
+    expression_when_reported[0] = '\0';
+    test_want(constraint, "basket", make_cgreen_integer_value(4), "file", 2, reporter);
+    assert_that(expression_when_reported, is_equal_to_string("[apples] parameter in [basket]"));
+
+    destroy_constraint(constraint);
+}
+
+Ensure(TextReporter, will_call_show_functions_of_reporters_of_the_first_version) {
+    reporter->show_fail = &show_fail_of_first_version;
+    reporter->start_test(reporter, "test_name");
+
+    (*reporter->assert_true)(reporter, "file", 2, false, "%d apples", 3);
+
+    assert_that(output, is_equal_to_string("3 apples at file:2"));
+}
+
+Ensure(TextReporter, will_report_duration_of_suite_in_milliseconds) {
+    reporter->start_suite(reporter, "suite_name", 1);
+    reporter->start_test(reporter, "test_name");
+    (*reporter->assert_true)(reporter, "file", 2, true, "");
+    send_reporter_completion_notification(reporter);
+    reporter->finish_test(reporter, "filename", line, NULL);
+    reporter->total_duration_ns = 5000000000ull;
+    reporter->finish_suite(reporter, "filename", line);
+
+    assert_that(output, contains_string("1 pass in 5000ms"));
+}
+
+Ensure(TextReporter, will_keep_durations_in_milliseconds_for_reporters_built_against_them) {
+    reporter->start_suite(reporter, "suite_name", 1);
+    reporter->start_test(reporter, "test_name");
+    send_reporter_completion_notification(reporter);
+    reporter->duration_ns = 7000000;
+    reporter->finish_test(reporter, "filename", line, NULL);
+    reporter->total_duration_ns = 5000000000ull;
+    reporter->finish_suite(reporter, "filename", line);
+
+    assert_that(reporter->duration, is_equal_to(7));
+    assert_that(reporter->total_duration, is_equal_to(5000));
+}
+
+Ensure(TextReporter, will_report_duration_and_resource_usage_of_each_test_in_verbose_mode) {
+    TextReporterOptions options;
+    memset(&options, 0, sizeof(options));
+    options.verbose_mode = true;
+    set_reporter_options(reporter, &options);
+
+    reporter->start_suite(reporter, "suite_name", 1);
+    reporter->start_test(reporter, "test_name");
+    send_reporter_completion_notification(reporter);
+    reporter->duration_ns = 7000000;
+    reporter->resource_usage.measured = 1;
+    reporter->resource_usage.user_time = 3000000;
+    reporter->resource_usage.max_resident_set_size = 2048;
+    reporter->finish_test(reporter, "filename", line, NULL);
+
+    assert_that(output, contains_string("\"test_name\": 7ms, user 3ms, system 0ms, max RSS 2048kB"));
+}
+
+Ensure(TextReporter, will_report_allocations_of_each_test_in_verbose_mode) {
+    TextReporterOptions options;
+    memset(&options, 0, sizeof(options));
+    options.verbose_mode = true;
+    set_reporter_options(reporter, &options);
+
+    reporter->start_suite(reporter, "suite_name", 1);
+    reporter->start_test(reporter, "test_name");
+    send_reporter_completion_notification(reporter);
+    reporter->resource_usage.allocations.counted = 1;
+    reporter->resource_usage.allocations.allocations = 3;
+    reporter->resource_usage.allocations.bytes = 96;
+    reporter->resource_usage.allocations.peak_bytes = 64;
+    reporter->resource_usage.allocations.unfreed_allocations = 1;
+    reporter->finish_test(reporter, "filename", line, NULL);
+
+    assert_that(output, contains_string("3 allocations of 96 bytes, peak 64 bytes, 1 unfreed."));
+}
+
+Ensure(TextReporter, will_report_benchmark_statistics_per_iteration) {
+    CgreenBenchmarkStatistics statistics = { 1000, 100, 1.0, 2.5, 3.25, 10.0, 0.5, { 0.0 } };
+
+    reporter->start_suite(reporter, "suite_name", 1);
+    reporter->start_test(reporter, "test_name");
+    reporter->show_benchmark(reporter, "file", 2, &statistics);
+
+    assert_that(output, contains_string("file:2: Benchmark: test_name"));
+    assert_that(output, contains_string("100 samples of 1000 iterations, per iteration: min 1.0ns, median 2.5ns,"
+                                        " mean 3.2ns, p99 10.0ns, stddev 0.5ns"));
+}
+
 Ensure(TextReporter, will_report_no_asserts_for_suites_with_no_asserts) {
     reporter->start_suite(reporter, "suite_name", 15);
     reporter->start_test(reporter, "test_name");
@@ -192,8 +419,21 @@ TestSuite *text_reporter_tests(void) {
     set_setup(suite, text_reporter_tests_setup);
 
     add_test_with_context(suite, TextReporter, will_report_beginning_and_end_of_suites);
+    add_test_with_context(suite, TextReporter, will_report_duration_of_suite_in_milliseconds);
+    add_test_with_context(suite, TextReporter, will_keep_durations_in_milliseconds_for_reporters_built_against_them);
+    add_test_with_context(suite, TextReporter, will_report_duration_and_resource_usage_of_each_test_in_verbose_mode);
+    add_test_with_context(suite, TextReporter, will_report_allocations_of_each_test_in_verbose_mode);
+    add_test_with_context(suite, TextReporter, will_report_benchmark_statistics_per_iteration);
     add_test_with_context(suite, TextReporter, will_report_passed_for_test_with_one_pass_on_completion);
+    add_test_with_context(suite, TextReporter, will_count_passes_without_sending_each_of_them);
+    add_test_with_context(suite, TextReporter, will_count_passes_before_and_after_a_failure);
+    add_test_with_context(suite, TextReporter, will_show_failures_sent_from_a_test_process);
     add_test_with_context(suite, TextReporter, will_report_failed_once_for_each_fail);
+    add_test_with_context(suite, TextReporter, will_give_failures_to_reporters_as_events);
+    add_test_with_context(suite, TextReporter, will_not_format_the_message_of_an_event_until_asked_for);
+    add_test_with_context(suite, TextReporter, will_tell_what_is_known_about_an_assertion_in_its_event);
+    add_test_with_context(suite, TextReporter, will_tell_the_same_expression_for_a_passing_and_a_failing_parameter);
+    add_test_with_context(suite, TextReporter, will_call_show_functions_of_reporters_of_the_first_version);
     add_test_with_context(suite, TextReporter, will_report_non_finishing_test);
 
     set_teardown(suite, text_reporter_tests_teardown);
@@ -0,0 +1,27 @@
+#include <cgreen/cgreen.h>
+
+#include <unistd.h>
+
+#ifdef __cplusplus
+using namespace cgreen;
+#endif
+
+Describe(TimeoutMessage);
+BeforeEach(TimeoutMessage) {}
+AfterEach(TimeoutMessage) {}
+Timeout(TimeoutMessage, 200);
+
+Ensure(TimeoutMessage, for_time_out_of_a_context) {
+    sleep(3);
+    fail_test("This test should have been aborted after the 200 ms of its context.");
+}
+
+EnsureWithin(100, TimeoutMessage, for_time_out_of_a_single_test) {
+    sleep(3);
+    fail_test("This test should have been aborted after its own 100 ms.");
+}
+
+EnsureWithin(2000, TimeoutMessage, is_not_given_when_the_test_allows_more_time_than_its_context) {
+    usleep(300000);
+    pass_test();
+}
@@ -120,6 +120,67 @@ Ensure(XmlReporter, will_report_a_failing_test) {
 }
 
 
+Ensure(XmlReporter, will_report_duration_of_test_in_seconds_with_microsecond_resolution) {
+    reporter->start_test(reporter, "test_name");
+    send_reporter_completion_notification(reporter);
+    reporter->duration_ns = 50000;
+    reporter->finish_test(reporter, "filename", line, NULL);
+
+    assert_that(output, contains_string("time=\"0.000050\""));
+}
+
+
+Ensure(XmlReporter, will_report_resource_usage_of_test_as_properties) {
+    reporter->start_test(reporter, "test_name");
+    send_reporter_completion_notification(reporter);
+    reporter->resource_usage.measured = 1;
+    reporter->resource_usage.user_time = 2000000;
+    reporter->resource_usage.max_resident_set_size = 1234;
+    reporter->finish_test(reporter, "filename", line, NULL);
+
+    assert_that(output, contains_string("<property name=\"user_time\" value=\"0.002000\"/>"));
+    assert_that(output, contains_string("<property name=\"max_resident_set_size_kb\" value=\"1234\"/>"));
+    assert_that(strstr(output, "</properties>"), is_less_than(strstr(output, "</testcase>")));
+}
+
+
+Ensure(XmlReporter, will_report_allocations_of_test_as_properties) {
+    reporter->start_test(reporter, "test_name");
+    send_reporter_completion_notification(reporter);
+    reporter->resource_usage.allocations.counted = 1;
+    reporter->resource_usage.allocations.allocations = 3;
+    reporter->resource_usage.allocations.unfreed_bytes = -16;
+    reporter->finish_test(reporter, "filename", line, NULL);
+
+    assert_that(output, contains_string("<property name=\"allocations\" value=\"3\"/>"));
+    assert_that(output, contains_string("<property name=\"unfreed_bytes\" value=\"-16\"/>"));
+}
+
+
+Ensure(XmlReporter, will_not_report_resource_usage_that_was_not_measured) {
+    reporter->start_test(reporter, "test_name");
+    send_reporter_completion_notification(reporter);
+    reporter->finish_test(reporter, "filename", line, NULL);
+
+    assert_that(output, does_not_contain_string("<properties>"));
+}
+
+
+Ensure(XmlReporter, will_report_benchmark_statistics_and_resource_usage_as_the_same_properties) {
+    CgreenBenchmarkStatistics statistics = { 1000, 100, 1.0, 2.5, 3.25, 10.0, 0.5, { 0.0 } };
+
+    reporter->start_test(reporter, "test_name");
+    reporter->show_benchmark(reporter, "file", 2, &statistics);
+    send_reporter_completion_notification(reporter);
+    reporter->resource_usage.measured = 1;
+    reporter->finish_test(reporter, "filename", line, NULL);
+
+    assert_that(output, contains_string("<property name=\"benchmark_median_ns\" value=\"2.5\"/>"));
+    assert_that(strstr(output, "benchmark_median_ns"), is_less_than(strstr(output, "user_time")));
+    assert_that(strstr(strstr(output, "<properties>") + 1, "<properties>"), is_null);
+}
+
+
 Ensure(XmlReporter, will_report_finishing_of_suite) {
     reporter->start_suite(reporter, "suite_name", 1);
     reporter->finish_suite(reporter, "filename", line);
@@ -163,6 +224,11 @@ TestSuite *xml_reporter_tests(void) {
     add_test_with_context(suite, XmlReporter, will_report_beginning_of_suite);
     add_test_with_context(suite, XmlReporter, will_report_beginning_and_successful_finishing_of_passing_test);
     add_test_with_context(suite, XmlReporter, will_report_a_failing_test);
+    add_test_with_context(suite, XmlReporter, will_report_duration_of_test_in_seconds_with_microsecond_resolution);
+    add_test_with_context(suite, XmlReporter, will_report_resource_usage_of_test_as_properties);
+    add_test_with_context(suite, XmlReporter, will_report_allocations_of_test_as_properties);
+    add_test_with_context(suite, XmlReporter, will_not_report_resource_usage_that_was_not_measured);
+    add_test_with_context(suite, XmlReporter, will_report_benchmark_statistics_and_resource_usage_as_the_same_properties);
     add_test_with_context(suite, XmlReporter, will_mark_ignored_test_as_skipped);
     add_test_with_context(suite, XmlReporter, will_report_finishing_of_suite);
     add_test_with_context(suite, XmlReporter, will_report_non_finishing_test);
@@ -41,7 +41,7 @@ print <<'EOF';
 
 //mock1 works for 1 or 0
 #define mock1(test_reporter, function_name, mock_file, mock_line, arguments_string, ...)\
-  mock_(test_reporter, function_name, mock_file, mock_line, arguments_string, __VA_ARGS__)
+    mock_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t)__VA_ARGS__)
 
 EOF
 
@@ -50,7 +50,7 @@ my @mocks = ("mock_", "mock_");
 
 for my $i (2 .. 63) {
     push(@mocks, sprintf("mock%d", $i));
-    push(@macros, define_mock($i));
+    push(@macros, define_mock("mock", "mock_", $i));
 }
 
 my @reverse_mocks = reverse(@mocks);
@@ -70,11 +70,27 @@ while (@chunk = splice(@reverse_mocks, 0, 10)) {
 
 print "\n";
 print join("\n", @macros);
+
+# The same for mock_double(), which returns a double
+print <<'EOF';
+
+#define PP_NARG_DOUBLE(...) MOCK_macro_dispatcher(mock_double, __VA_ARGS__)
+
+#define mock_double1(test_reporter, function_name, mock_file, mock_line, arguments_string, ...)\
+    mock_double_(test_reporter, function_name, mock_file, mock_line, arguments_string, (intptr_t)__VA_ARGS__)
+
+EOF
+
+my @double_macros;
+for my $i (2 .. 63) {
+    push(@double_macros, define_mock("mock_double", "mock_double_", $i));
+}
+print join("\n", @double_macros);
 print "\n";
 print "#endif /* MOCK_TABLE_HEADER */\n";
 
 sub define_mock {
-    my ($num_args) = @_;
+    my ($name, $function, $num_args) = @_;
 
     my @args;
     my $i;
@@ -82,11 +98,11 @@ sub define_mock {
         push(@args, sprintf "arg%d", $i);
     }
 
-    my $macro = sprintf("#define mock%d", $num_args);
+    my $macro = sprintf("#define %s%d", $name, $num_args);
     $macro .= "(test_reporter, function_name, mock_file, mock_line, arguments_string, ";
     $macro .= join(", ", @args);
     $macro .= ")\\\n";
-    $macro .= "  mock_(test_reporter, function_name, mock_file, mock_line, arguments_string, ";
+    $macro .= "  $function(test_reporter, function_name, mock_file, mock_line, arguments_string, ";
     $macro .= join(", ", (map "(intptr_t) $_", @args));
     $macro .= ")\n";
 
@@ -32,7 +32,8 @@ static void version(void) {
 /*----------------------------------------------------------------------*/
 static void usage(const char **argv) {
     printf("cgreen-runner for Cgreen unittest and mocking framework v%s\n\n", VERSION);
-    printf("Usage:\n    %s [--xml <prefix>] [--suite <name>] [--verbose] [--quiet] [--no-run] [--help] (<library> [<test>])+\n\n", argv[0]);
+    printf("Usage:\n    %s [--xml <prefix>] [--suite <name>] [--jobs <n>] [--isolation <level>] [--benchmark-baseline <file>] [--benchmark-threshold <percent>] [--save-benchmark-baseline <file>] [--journal <file>] [--verbose] [--quiet] [--no-run] [--help] (<library> [<test>])+\n", argv[0]);
+    printf("    %s --print-journal <file>\n\n", argv[0]);
     printf("Discover and run all or named cgreen test(s) from one or multiple\n");
     printf("dynamically loadable libraries.\n\n");
     printf("A single test can be run using the form [<context>:]<name> where <context> can\n");
@@ -43,8 +44,20 @@ static void usage(const char **argv) {
     printf("\t\t\t\tper suite, compatible with Hudson/Jenkins CI. The filename(s)\n");
     printf("\t\t\t\twill be '<prefix>-<suite>.xml'\n");
     printf("  -s --suite <name>\t\tName the top level suite\n");
+    printf("  -j --jobs <n>\t\t\tRun up to <n> tests in parallel, output is still in test order\n");
+    printf("  -i --isolation <level>\tRun each 'test' (default), 'context' or the whole 'library'\n");
+    printf("\t\t\t\tin a process of its own\n");
+    printf("     --benchmark-baseline <file>\tFail benchmarks that are significantly slower than in\n");
+    printf("\t\t\t\tthe baseline <file>\n");
+    printf("     --benchmark-threshold <percent>\tHow much slower than the baseline a benchmark may\n");
+    printf("\t\t\t\tbe, default is 10%%\n");
+    printf("     --save-benchmark-baseline <file>\tSave the benchmark results as a baseline in <file>\n");
+    printf("     --journal <file>\t\tWrite the results into <file> as they happen, so that it\n");
+    printf("\t\t\t\ttells how far tests that crashed or hung got\n");
+    printf("     --print-journal <file>\tPrint the journal in <file>\n");
     printf("  -n --no-run\t\t\tDon't run the tests\n");
-    printf("  -v --verbose\t\t\tShow progress information\n");
+    printf("  -v --verbose\t\t\tShow progress information, and the duration and resource\n");
+    printf("\t\t\t\tusage of each test\n");
     printf("  -q --quiet\t\t\tJust output dots for each test\n");
     printf("     --version\t\t\tShow version information\n");
 }
@@ -93,6 +106,41 @@ static int initialize_option_handling(int argc, const char **argv) {
                                                             gopt_shorts('s'),
                                                             gopt_longs("suite")
                                                             ),
+                                                gopt_option('j',
+                                                            GOPT_ARG,
+                                                            gopt_shorts('j'),
+                                                            gopt_longs("jobs")
+                                                            ),
+                                                gopt_option('i',
+                                                            GOPT_ARG,
+                                                            gopt_shorts('i'),
+                                                            gopt_longs("isolation")
+                                                            ),
+                                                gopt_option('b',
+                                                            GOPT_ARG,
+                                                            gopt_shorts(0),
+                                                            gopt_longs("benchmark-baseline")
+                                                            ),
+                                                gopt_option('t',
+                                                            GOPT_ARG,
+                                                            gopt_shorts(0),
+                                                            gopt_longs("benchmark-threshold")
+                                                            ),
+                                                gopt_option('B',
+                                                            GOPT_ARG,
+                                                            gopt_shorts(0),
+                                                            gopt_longs("save-benchmark-baseline")
+                                                            ),
+                                                gopt_option('J',
+                                                            GOPT_ARG,
+                                                            gopt_shorts(0),
+                                                            gopt_longs("journal")
+                                                            ),
+                                                gopt_option('P',
+                                                            GOPT_ARG,
+                                                            gopt_shorts(0),
+                                                            gopt_longs("print-journal")
+                                                            ),
                                                 gopt_option('v',
                                                             GOPT_NOARG,
                                                             gopt_shorts('v'),
@@ -153,13 +201,13 @@ static bool have_xml_option(void) {
 
 /*----------------------------------------------------------------------*/
 static bool run_tests_in_library(const char *suite_name_option, const char *test_name,
-                                 const char *test_library, bool verbose, bool no_run) {
+                                 const char *test_library, int jobs, bool verbose, bool no_run) {
     int status;
     char *suite_name;
 
     suite_name = get_a_suite_name(suite_name_option, test_library);
 
-    status = runner(reporter, test_library, suite_name, test_name, verbose, no_run);
+    status = runner(reporter, test_library, suite_name, test_name, jobs, verbose, no_run);
     free((void*)suite_name);
 
     return status != 0;
@@ -200,8 +248,16 @@ int main(int argc, const char **argv) {
 
     bool verbose = false;
     bool no_run = false;
+    int jobs = 0;
 
     const char *prefix_option;
+    const char *jobs_option;
+    const char *isolation_option;
+    const char *baseline_option;
+    const char *threshold_option;
+    const char *save_baseline_option;
+    const char *journal_option;
+    double benchmark_threshold = 10.0;
     const char *suite_name_option = NULL;
     const char *tmp;
 
@@ -218,6 +274,45 @@ int main(int argc, const char **argv) {
 
     gopt_arg(options, 's', &suite_name_option);
 
+    if (gopt_arg(options, 'j', &jobs_option)) {
+        jobs = atoi(jobs_option);
+        if (jobs <= 0) {
+            printf("Invalid number of jobs: %s\n", jobs_option);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (gopt_arg(options, 'i', &isolation_option)) {
+        if (strcmp(isolation_option, "test") == 0)
+            set_test_isolation(isolate_tests);
+        else if (strcmp(isolation_option, "context") == 0)
+            set_test_isolation(isolate_contexts);
+        else if (strcmp(isolation_option, "library") == 0)
+            set_test_isolation(isolate_library);
+        else {
+            printf("Invalid isolation level: %s\n", isolation_option);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (gopt_arg(options, 't', &threshold_option)) {
+        char *end;
+        benchmark_threshold = strtod(threshold_option, &end);
+        if (end == threshold_option || *end != '\0' || benchmark_threshold < 0.0) {
+            printf("Invalid benchmark threshold: %s\n", threshold_option);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (gopt_arg(options, 'b', &baseline_option))
+        compare_benchmarks_with_baseline(baseline_option, benchmark_threshold);
+
+    if (gopt_arg(options, 'B', &save_baseline_option))
+        save_benchmarks_as_baseline(save_baseline_option);
+
+    if (gopt_arg(options, 'J', &journal_option))
+        keep_journal_in(journal_option);
+
     if (gopt_arg(options, 'v', &tmp))
         verbose = true;
 
@@ -237,6 +332,7 @@ int main(int argc, const char **argv) {
         reporter_options.quiet_mode = true;
     else
         reporter_options.quiet_mode = false;
+    reporter_options.verbose_mode = verbose;
 
     if (gopt_arg(options, 'h', &tmp)) {
         usage(argv);
@@ -248,6 +344,14 @@ int main(int argc, const char **argv) {
         return EXIT_SUCCESS;
     }
 
+    if (gopt_arg(options, 'P', &journal_option)) {
+        if (!print_journal(journal_option)) {
+            printf("Could not read journal: %s\n", journal_option);
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+
     if (argc < 2) {
         usage(argv);
         return EXIT_FAILURE;
@@ -310,7 +414,7 @@ int main(int argc, const char **argv) {
             inhibit_appropriate_suite_message(i, library_count);
 
         fail = run_tests_in_library(suite_name_option, testname[i], libraries[i],
-                                    verbose, no_run);
+                                    jobs, verbose, no_run);
         if (fail) any_fail = true;
     }
 
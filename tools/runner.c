@@ -102,11 +102,52 @@ static TestSuite *find_suite_for_context(ContextSuite *suites, const char *conte
 
 
 /*----------------------------------------------------------------------*/
-static ContextSuite *add_new_context_suite(TestSuite *parent, const char* context_name,
+/* BeforeAll and AfterAll are optional, so they are not referenced
+   from the tests but looked up by name, if there is one it is a
+   pointer to the function to run */
+static void (*find_context_hook(void *handle, const char *prefix, const char *context_name))(void) {
+    char *hook_name = (char *)malloc(strlen(prefix) + strlen(context_name) + 1);
+    void (**hook)(void);
+
+    strcpy(hook_name, prefix);
+    strcat(hook_name, context_name);
+    hook = (void (**)(void))dlsym(handle, hook_name);
+    dlerror();
+    free(hook_name);
+
+    return hook != NULL ? *hook : NULL;
+}
+
+
+/*----------------------------------------------------------------------*/
+static unsigned int find_context_timeout(void *handle, const char *context_name) {
+    char *timeout_name = (char *)malloc(strlen(CGREEN_TIMEOUT_PREFIX) + strlen(context_name) + 1);
+    unsigned int *timeout;
+
+    strcpy(timeout_name, CGREEN_TIMEOUT_PREFIX);
+    strcat(timeout_name, context_name);
+    timeout = (unsigned int *)dlsym(handle, timeout_name);
+    dlerror();
+    free(timeout_name);
+
+    return timeout != NULL ? *timeout : 0;
+}
+
+
+/*----------------------------------------------------------------------*/
+static ContextSuite *add_new_context_suite(void *handle, TestSuite *parent, const char* context_name,
                                            ContextSuite *next) {
     ContextSuite *new_context_suite = (ContextSuite *)calloc(1, sizeof(ContextSuite));
+    void (*before_all)(void) = find_context_hook(handle, CGREEN_BEFORE_ALL_PREFIX, context_name);
+    void (*after_all)(void) = find_context_hook(handle, CGREEN_AFTER_ALL_PREFIX, context_name);
+
     new_context_suite->context_name = string_dup(context_name);
     new_context_suite->suite = create_named_test_suite(context_name);
+    if (before_all != NULL)
+        set_before_all(new_context_suite->suite, before_all);
+    if (after_all != NULL)
+        set_after_all(new_context_suite->suite, after_all);
+    set_test_timeout(new_context_suite->suite, find_context_timeout(handle, context_name));
     new_context_suite->next = next;
     add_suite_(parent, context_name, new_context_suite->suite);
     return new_context_suite;
@@ -114,12 +155,12 @@ static ContextSuite *add_new_context_suite(TestSuite *parent, const char* contex
 
 
 /*----------------------------------------------------------------------*/
-static void add_test_to_context(TestSuite *parent, ContextSuite **context_suites,
+static void add_test_to_context(void *handle, TestSuite *parent, ContextSuite **context_suites,
                                 TestItem *test_item, CgreenTest *test) {
     TestSuite *suite_for_context = find_suite_for_context(*context_suites, test_item->context_name);
 
     if (suite_for_context == NULL) {
-        *context_suites = add_new_context_suite(parent, test_item->context_name, *context_suites);
+        *context_suites = add_new_context_suite(handle, parent, test_item->context_name, *context_suites);
         suite_for_context = (*context_suites)->suite;
     }
     add_test_(suite_for_context, test_item->test_name, test);
@@ -153,7 +194,7 @@ static int add_matching_tests_to_suite(void *handle,
                 return -1;
             }
 
-            add_test_to_context(suite, context_suites, get_item_from(tests, i), test_function);
+            add_test_to_context(handle, suite, context_suites, get_item_from(tests, i), test_function);
             count++;
         }
     }
@@ -189,6 +230,7 @@ static int run_tests(TestReporter *reporter,
                      const char *symbolic_name,
                      void *test_library_handle,
                      CgreenVector *tests,
+                     int jobs,
                      bool verbose) {
     int status;
     ContextSuite *context_suites = NULL;
@@ -221,7 +263,9 @@ static int run_tests(TestReporter *reporter,
                 printf(" to run all %d discovered tests ...\n", count(tests));
         }
 
-        if (number_of_matches > 0)
+        if (number_of_matches > 0 && jobs > 0)
+            status = run_test_suite_parallel(suite, reporter, jobs);
+        else if (number_of_matches > 0)
             status = run_test_suite(suite, reporter);
         else {
             fprintf(stderr, "ERROR: No such test: '%s' in '%s'\n", symbolic_name, suite_name);
@@ -278,7 +322,7 @@ static char *absolute(const char *file_path) {
 /*======================================================================*/
 int runner(TestReporter *reporter, const char *test_library_name,
            const char *suite_name, const char *test_name,
-           bool verbose, bool dont_run) {
+           int jobs, bool verbose, bool dont_run) {
     int status = 0;
     void *test_library_handle = NULL;
 
@@ -304,7 +348,7 @@ int runner(TestReporter *reporter, const char *test_library_name,
     } else {
         if (!dont_run) {
             status = run_tests(reporter, suite_name, test_name, test_library_handle,
-                               tests, verbose);
+                               tests, jobs, verbose);
         }
         dlclose(test_library_handle);
     }
@@ -3,6 +3,6 @@
 
 /* Cgreen runner module */
 
-extern int runner(TestReporter *reporter, const char *test_library, const char *suite_name, const char *test_name, bool verbose, bool no_run);
+extern int runner(TestReporter *reporter, const char *test_library, const char *suite_name, const char *test_name, int jobs, bool verbose, bool no_run);
 
 #endif
@@ -80,6 +80,7 @@ Ensure(Runner, can_match_test_name) {
 
 Ensure(Runner, can_add_test_to_the_suite_for_its_context) {
     ContextSuite *suite_list = NULL;
+    void *handle = dlopen(NULL, RTLD_NOW);
     CgreenTest *test = (CgreenTest *)&test;
     TestSuite *parent_suite = create_test_suite();
     TestSuite *first_suite, *second_suite;
@@ -88,7 +89,7 @@ Ensure(Runner, can_add_test_to_the_suite_for_its_context) {
 
     assert_that(suite_list, is_null);
 
-    add_test_to_context(parent_suite, &suite_list, &test_item1, test);
+    add_test_to_context(handle, parent_suite, &suite_list, &test_item1, test);
     first_suite = find_suite_for_context(suite_list, "TheFirstContext");
     assert_that(first_suite, is_non_null);
     assert_that(first_suite->size, is_equal_to(1));
@@ -96,12 +97,13 @@ Ensure(Runner, can_add_test_to_the_suite_for_its_context) {
     second_suite = find_suite_for_context(suite_list, "TheSecondContext");
     assert_that(second_suite, is_null);
 
-    add_test_to_context(parent_suite, &suite_list, &test_item2, test);
+    add_test_to_context(handle, parent_suite, &suite_list, &test_item2, test);
     assert_that(find_suite_for_context(suite_list, "TheFirstContext")->size, is_equal_to(1));
     assert_that(find_suite_for_context(suite_list, "TheSecondContext")->size, is_equal_to(1));
 
     destroy_test_suite(parent_suite);
     destroy_context_suites(suite_list);
+    dlclose(handle);
 }
 
 Ensure(Runner, can_sort_an_empty_list_of_tests) {